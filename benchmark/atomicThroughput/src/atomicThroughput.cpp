@@ -0,0 +1,201 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+
+//#############################################################################
+//! A kernel in which all threads of a block repeatedly apply TOp to the same value.
+template<
+    typename TOp>
+class AtomicOpKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc,
+        typename T>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        std::size_t const numOps,
+        T const value) const
+    -> void
+    {
+        auto & var = alpaka::block::shared::st::allocVar<T, __COUNTER__>(acc);
+        if(alpaka::idx::getIdx<alpaka::Block, alpaka::Threads>(acc)[0u] == 0u)
+        {
+            var = static_cast<T>(0);
+        }
+        alpaka::block::sync::syncBlockThreads(acc);
+
+        for(std::size_t i(0u); i < numOps; ++i)
+        {
+            alpaka::atomic::atomicOp<TOp>(acc, &var, value, alpaka::hierarchy::Threads());
+        }
+    }
+};
+
+//#############################################################################
+//! A kernel in which all threads of a block repeatedly increment the same value with compare-and-swap like a lock-free work queue.
+class AtomicCasKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc,
+        typename T>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        std::size_t const numOps,
+        T const value) const
+    -> void
+    {
+        auto & var = alpaka::block::shared::st::allocVar<T, __COUNTER__>(acc);
+        if(alpaka::idx::getIdx<alpaka::Block, alpaka::Threads>(acc)[0u] == 0u)
+        {
+            var = static_cast<T>(0);
+        }
+        alpaka::block::sync::syncBlockThreads(acc);
+
+        // A failed swap returns the current value which is the next guess.
+        T old(static_cast<T>(0));
+        for(std::size_t i(0u); i < numOps; ++i)
+        {
+            T assumed;
+            do
+            {
+                assumed = old;
+                old = alpaka::atomic::atomicOp<alpaka::atomic::op::Cas>(acc, &var, assumed, static_cast<T>(assumed + value), alpaka::hierarchy::Threads());
+            }
+            while(old != assumed);
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------
+//! Executes a single block with the given number of threads and prints the atomic operations per second.
+template<
+    typename TAcc,
+    typename TKernel,
+    typename T>
+auto measureAtomicThroughput(
+    std::string const & accName,
+    std::string const & opName,
+    std::string const & typeName,
+    std::size_t const blockThreadCount,
+    std::size_t const numOps,
+    T const value)
+-> void
+{
+    using Dim = alpaka::dim::Dim<TAcc>;
+    using Idx = alpaka::idx::Idx<TAcc>;
+    using Queue = alpaka::queue::Queue<TAcc, alpaka::queue::Blocking>;
+
+    auto const devAcc(alpaka::pltf::getDevByIdx<TAcc>(0u));
+    Queue queue(devAcc);
+
+    auto const devProps(alpaka::acc::getAccDevProps<TAcc>(devAcc));
+    if(blockThreadCount > static_cast<std::size_t>(devProps.m_blockThreadCountMax))
+    {
+        return;
+    }
+
+    alpaka::workdiv::WorkDivMembers<Dim, Idx> const workDiv(
+        static_cast<Idx>(1u),
+        static_cast<Idx>(blockThreadCount),
+        static_cast<Idx>(1u));
+
+    // Warm up so that the threads of the device already exist.
+    alpaka::kernel::exec<TAcc>(queue, workDiv, TKernel{}, static_cast<std::size_t>(1u), value);
+
+    auto const beginT(std::chrono::high_resolution_clock::now());
+    alpaka::kernel::exec<TAcc>(queue, workDiv, TKernel{}, numOps, value);
+    auto const endT(std::chrono::high_resolution_clock::now());
+
+    std::cout
+        << std::setw(12) << std::left << accName
+        << " op: " << std::setw(4) << std::left << opName
+        << " type: " << std::setw(8) << std::left << typeName
+        << " threads: " << std::setw(3) << std::right << blockThreadCount
+        << " atomics per second: " << std::setw(14) << std::right << static_cast<double>(numOps * blockThreadCount) / std::chrono::duration<double>(endT - beginT).count()
+        << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+//! Measures all operations for the given accelerator and value type.
+template<
+    typename TAcc,
+    typename T>
+auto measureAtomicThroughputOps(
+    std::string const & accName,
+    std::string const & typeName,
+    std::size_t const blockThreadCount,
+    std::size_t const numOps)
+-> void
+{
+    measureAtomicThroughput<TAcc, AtomicOpKernel<alpaka::atomic::op::Add>>(accName, "Add", typeName, blockThreadCount, numOps, static_cast<T>(1));
+    measureAtomicThroughput<TAcc, AtomicOpKernel<alpaka::atomic::op::Max>>(accName, "Max", typeName, blockThreadCount, numOps, static_cast<T>(1));
+    measureAtomicThroughput<TAcc, AtomicOpKernel<alpaka::atomic::op::Inc>>(accName, "Inc", typeName, blockThreadCount, numOps, std::numeric_limits<T>::max());
+    measureAtomicThroughput<TAcc, AtomicOpKernel<alpaka::atomic::op::Dec>>(accName, "Dec", typeName, blockThreadCount, numOps, std::numeric_limits<T>::max());
+    measureAtomicThroughput<TAcc, AtomicCasKernel>(accName, "Cas", typeName, blockThreadCount, numOps, static_cast<T>(1));
+}
+
+//-----------------------------------------------------------------------------
+//! Measures all operations and value types for the given accelerator.
+template<
+    typename TAcc>
+auto measureAtomicThroughputTypes(
+    std::string const & accName,
+    std::size_t const blockThreadCount,
+    std::size_t const numOps)
+-> void
+{
+    measureAtomicThroughputOps<TAcc, std::uint32_t>(accName, "uint32", blockThreadCount, numOps);
+    measureAtomicThroughputOps<TAcc, std::uint64_t>(accName, "uint64", blockThreadCount, numOps);
+}
+
+auto main(
+    int argc,
+    char * argv[])
+-> int
+{
+#if !defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED) && !defined(ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLED) && !defined(ALPAKA_ACC_CPU_BT_OMP4_ENABLED)
+    alpaka::ignore_unused(argc);
+    alpaka::ignore_unused(argv);
+    std::cout << "Neither the CPU threads, the CPU OpenMP 2.0 threads nor the CPU OpenMP 4.0 accelerator is enabled!" << std::endl;
+#else
+    std::size_t const numOps(argc > 1 ? std::stoul(argv[1]) : 100000u);
+
+    using Dim = alpaka::dim::DimInt<1u>;
+    using Idx = std::size_t;
+
+    for(std::size_t blockThreadCount : {1u, 2u, 4u, 8u})
+    {
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+        measureAtomicThroughputTypes<alpaka::acc::AccCpuThreads<Dim, Idx>>("threads", blockThreadCount, numOps);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLED)
+        measureAtomicThroughputTypes<alpaka::acc::AccCpuOmp2Threads<Dim, Idx>>("omp2Threads", blockThreadCount, numOps);
+#endif
+#if defined(ALPAKA_ACC_CPU_BT_OMP4_ENABLED)
+        measureAtomicThroughputTypes<alpaka::acc::AccCpuOmp4<Dim, Idx>>("omp4", blockThreadCount, numOps);
+#endif
+    }
+#endif
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,77 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/core/BarrierThread.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+//! Lets the given number of threads wait at the barrier repeatedly and prints the time per wait.
+//! Independent of the barrier selected for the threads accelerator, all barrier implementations are measured.
+template<
+    typename TBarrier>
+auto measureBarrierLatency(
+    std::string const & name,
+    std::size_t const threadCount,
+    std::size_t const numWaits)
+-> void
+{
+    TBarrier barrier(threadCount);
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount);
+
+    auto const beginT(std::chrono::high_resolution_clock::now());
+    for(std::size_t i(0u); i < threadCount; ++i)
+    {
+        threads.emplace_back(
+            [&barrier, numWaits]()
+            {
+                for(std::size_t j(0u); j < numWaits; ++j)
+                {
+                    barrier.wait();
+                }
+            });
+    }
+    for(auto & thread : threads)
+    {
+        thread.join();
+    }
+    auto const endT(std::chrono::high_resolution_clock::now());
+
+    std::cout
+        << std::setw(16) << std::left << name
+        << " threads: " << std::setw(4) << std::right << threadCount
+        << " time per wait: " << std::setw(12) << std::right << std::chrono::duration<double, std::nano>(endT - beginT).count() / static_cast<double>(numWaits) << " ns"
+        << std::endl;
+}
+
+auto main(
+    int argc,
+    char * argv[])
+-> int
+{
+    std::size_t const numWaits(argc > 1 ? std::stoul(argv[1]) : 10000u);
+
+    std::cout << "spin rounds before parking: " << ALPAKA_THREAD_BARRIER_SPIN_COUNT
+        << ", hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+
+    for(std::size_t threadCount : {1u, 2u, 4u, 8u, 16u, 32u, 64u})
+    {
+        measureBarrierLatency<alpaka::core::threads::BarrierThread<std::size_t>>("central", threadCount, numWaits);
+        measureBarrierLatency<alpaka::core::threads::BarrierThreadTree<std::size_t>>("tree", threadCount, numWaits);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,110 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+//#############################################################################
+//! A kernel synchronizing its block threads repeatedly so that the cost of a barrier dominates.
+class SyncBlockThreadsKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        std::size_t const numSyncs) const
+    -> void
+    {
+        for(std::size_t i(0u); i < numSyncs; ++i)
+        {
+            alpaka::block::sync::syncBlockThreads(acc);
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------
+//! Executes a single block with the given number of threads and prints the time per syncBlockThreads.
+template<
+    typename TAcc>
+auto measureBlockSyncLatency(
+    std::string const & name,
+    std::size_t const blockThreadCount,
+    std::size_t const numSyncs)
+-> void
+{
+    using Dim = alpaka::dim::Dim<TAcc>;
+    using Idx = alpaka::idx::Idx<TAcc>;
+    using Queue = alpaka::queue::Queue<TAcc, alpaka::queue::Blocking>;
+
+    auto const devAcc(alpaka::pltf::getDevByIdx<TAcc>(0u));
+    Queue queue(devAcc);
+
+    auto const devProps(alpaka::acc::getAccDevProps<TAcc>(devAcc));
+    if(blockThreadCount > static_cast<std::size_t>(devProps.m_blockThreadCountMax))
+    {
+        return;
+    }
+
+    alpaka::workdiv::WorkDivMembers<Dim, Idx> const workDiv(
+        static_cast<Idx>(1u),
+        static_cast<Idx>(blockThreadCount),
+        static_cast<Idx>(1u));
+
+    // Warm up so that the threads of the device and the fiber stacks already exist.
+    alpaka::kernel::exec<TAcc>(queue, workDiv, SyncBlockThreadsKernel{}, static_cast<std::size_t>(1u));
+
+    auto const beginT(std::chrono::high_resolution_clock::now());
+    alpaka::kernel::exec<TAcc>(queue, workDiv, SyncBlockThreadsKernel{}, numSyncs);
+    auto const endT(std::chrono::high_resolution_clock::now());
+
+    std::cout
+        << std::setw(16) << std::left << name
+        << " threads: " << std::setw(4) << std::right << blockThreadCount
+        << " time per syncBlockThreads: " << std::setw(12) << std::right << std::chrono::duration<double, std::nano>(endT - beginT).count() / static_cast<double>(numSyncs) << " ns"
+        << std::endl;
+}
+
+auto main(
+    int argc,
+    char * argv[])
+-> int
+{
+#if !defined(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED) && !defined(ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLED) && !defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+    alpaka::ignore_unused(argc);
+    alpaka::ignore_unused(argv);
+    std::cout << "Neither the CPU fibers, the CPU lanes nor the CPU threads accelerator is enabled!" << std::endl;
+#else
+    std::size_t const numSyncs(argc > 1 ? std::stoul(argv[1]) : 10000u);
+
+    using Dim = alpaka::dim::DimInt<1u>;
+    using Idx = std::size_t;
+
+    for(std::size_t blockThreadCount : {1u, 2u, 4u, 8u, 16u, 32u})
+    {
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED)
+        measureBlockSyncLatency<alpaka::acc::AccCpuFibers<Dim, Idx>>("fibers", blockThreadCount, numSyncs);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLED)
+        measureBlockSyncLatency<alpaka::acc::AccCpuLanes<Dim, Idx>>("lanes", blockThreadCount, numSyncs);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+        measureBlockSyncLatency<alpaka::acc::AccCpuThreads<Dim, Idx>>("threads", blockThreadCount, numSyncs);
+#endif
+    }
+#endif
+    return EXIT_SUCCESS;
+}
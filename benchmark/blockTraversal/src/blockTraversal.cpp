@@ -0,0 +1,179 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+//#############################################################################
+//! Each block multiplies a row panel of A with a column panel of B into one tile of C.
+//! Neighbouring blocks share their panels so the traversal order of the grid decides how often they are loaded from memory.
+class MatMulTileKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    explicit MatMulTileKernel(
+        alpaka::kernel::BlockSchedule const & blockSchedule) :
+            m_blockSchedule(blockSchedule)
+    {}
+
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc,
+        typename TIdx>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        TIdx const & n,
+        float const * const pA,
+        float const * const pB,
+        float * const pC) const
+    -> void
+    {
+        auto const threadElemExtent(alpaka::workdiv::getWorkDiv<alpaka::Thread, alpaka::Elems>(acc));
+        auto const tileOrigin(alpaka::idx::getIdx<alpaka::Grid, alpaka::Threads>(acc) * threadElemExtent);
+
+        for(TIdx row(tileOrigin[0]); row < tileOrigin[0] + threadElemExtent[0]; ++row)
+        {
+            for(TIdx k(0); k < n; ++k)
+            {
+                auto const a(pA[row * n + k]);
+                for(TIdx col(tileOrigin[1]); col < tileOrigin[1] + threadElemExtent[1]; ++col)
+                {
+                    pC[row * n + col] += a * pB[k * n + col];
+                }
+            }
+        }
+    }
+
+    alpaka::kernel::BlockSchedule m_blockSchedule;
+};
+
+namespace alpaka
+{
+    namespace kernel
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The block schedule is chosen at runtime by the kernel object.
+            template<
+                typename TAcc>
+            struct GetBlockSchedule<
+                MatMulTileKernel,
+                TAcc>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TVec,
+                    typename... TArgs>
+                ALPAKA_FN_HOST static auto getBlockSchedule(
+                    MatMulTileKernel const & kernel,
+                    TVec const &,
+                    TVec const &,
+                    TArgs const & ...)
+                -> BlockSchedule
+                {
+                    return kernel.m_blockSchedule;
+                }
+            };
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+//! Multiplies two n x n matrices once for each traversal order and prints the times.
+//! Run it within a profiler like `perf stat -e LLC-load-misses` to see the effect on the caches.
+template<
+    typename TAcc>
+auto measureBlockTraversal(
+    std::string const & name,
+    std::size_t const n,
+    std::size_t const tileSize)
+-> void
+{
+    using Dim = alpaka::dim::Dim<TAcc>;
+    using Idx = alpaka::idx::Idx<TAcc>;
+    using Vec = alpaka::vec::Vec<Dim, Idx>;
+    using Queue = alpaka::queue::Queue<TAcc, alpaka::queue::Blocking>;
+
+    auto const devAcc(alpaka::pltf::getDevByIdx<TAcc>(0u));
+    Queue queue(devAcc);
+
+    // The accelerators of this benchmark are CPU accelerators so the host memory can be used directly.
+    std::vector<float> a(n * n, 1.0f);
+    std::vector<float> b(n * n, 2.0f);
+    std::vector<float> c(n * n, 0.0f);
+
+    alpaka::workdiv::WorkDivMembers<Dim, Idx> const workDiv(
+        Vec::all(static_cast<Idx>(n / tileSize)),
+        Vec::ones(),
+        Vec::all(static_cast<Idx>(tileSize)));
+
+    using Order = alpaka::kernel::BlockTraversalOrder;
+    for(auto const & order : {
+        std::make_pair(Order::RowMajor, "rowMajor"),
+        std::make_pair(Order::Tiled, "tiled"),
+        std::make_pair(Order::ZOrder, "zOrder"),
+        std::make_pair(Order::Hilbert, "hilbert")})
+    {
+        MatMulTileKernel const kernel(
+            alpaka::kernel::BlockSchedule(
+                alpaka::kernel::BlockSchedulingPolicy::Auto,
+                0u,
+                order.first));
+
+        auto const beginT(std::chrono::high_resolution_clock::now());
+        alpaka::kernel::exec<TAcc>(queue, workDiv, kernel, static_cast<Idx>(n), a.data(), b.data(), c.data());
+        auto const endT(std::chrono::high_resolution_clock::now());
+
+        std::cout
+            << std::setw(12) << std::left << name
+            << " n: " << std::setw(6) << std::right << n
+            << " order: " << std::setw(10) << std::left << order.second
+            << " time: " << std::setw(12) << std::right << std::chrono::duration<double, std::milli>(endT - beginT).count() << " ms"
+            << std::endl;
+    }
+}
+
+auto main(
+    int argc,
+    char * argv[])
+-> int
+{
+#if !defined(ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED) && !defined(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED) && !defined(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED)
+    alpaka::ignore_unused(argc);
+    alpaka::ignore_unused(argv);
+    std::cout << "None of the CPU accelerators with one thread per block is enabled!" << std::endl;
+#else
+    // The default matrices do not fit into the last level cache.
+    std::size_t const n(argc > 1 ? std::stoul(argv[1]) : 1024u);
+    std::size_t const tileSize(argc > 2 ? std::stoul(argv[2]) : 32u);
+
+    using Dim = alpaka::dim::DimInt<2u>;
+    using Idx = std::size_t;
+
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED)
+    measureBlockTraversal<alpaka::acc::AccCpuSerial<Dim, Idx>>("serial", n, tileSize);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED)
+    measureBlockTraversal<alpaka::acc::AccCpuOmp2Blocks<Dim, Idx>>("omp2Blocks", n, tileSize);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED)
+    measureBlockTraversal<alpaka::acc::AccCpuTbbBlocks<Dim, Idx>>("tbbBlocks", n, tileSize);
+#endif
+#endif
+    return EXIT_SUCCESS;
+}
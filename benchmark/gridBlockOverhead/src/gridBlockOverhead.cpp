@@ -0,0 +1,118 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+//#############################################################################
+//! A kernel doing almost nothing so that the cost of switching between the grid blocks dominates.
+class EmptyBlockKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        std::uint32_t * const pBlockThreadSum) const
+    -> void
+    {
+        alpaka::atomic::atomicOp<alpaka::atomic::op::Add>(
+            acc,
+            pBlockThreadSum,
+            static_cast<std::uint32_t>(alpaka::idx::getIdx<alpaka::Block, alpaka::Threads>(acc)[0u]),
+            alpaka::hierarchy::Threads());
+    }
+};
+
+//-----------------------------------------------------------------------------
+//! Executes a grid of many small blocks and prints the time per block.
+template<
+    typename TAcc>
+auto measureGridBlockOverhead(
+    std::string const & name,
+    std::size_t const gridBlockCount,
+    std::size_t const blockThreadCount)
+-> void
+{
+    using Dim = alpaka::dim::Dim<TAcc>;
+    using Idx = alpaka::idx::Idx<TAcc>;
+    using Queue = alpaka::queue::Queue<TAcc, alpaka::queue::Blocking>;
+
+    auto const devAcc(alpaka::pltf::getDevByIdx<TAcc>(0u));
+    Queue queue(devAcc);
+
+    auto const devProps(alpaka::acc::getAccDevProps<TAcc>(devAcc));
+    if(blockThreadCount > static_cast<std::size_t>(devProps.m_blockThreadCountMax))
+    {
+        return;
+    }
+
+    alpaka::workdiv::WorkDivMembers<Dim, Idx> const workDiv(
+        static_cast<Idx>(gridBlockCount),
+        static_cast<Idx>(blockThreadCount),
+        static_cast<Idx>(1u));
+
+    std::uint32_t blockThreadSum(0u);
+
+    // Warm up so that the threads of the device already exist.
+    alpaka::kernel::exec<TAcc>(queue, workDiv, EmptyBlockKernel{}, &blockThreadSum);
+
+    auto const beginT(std::chrono::high_resolution_clock::now());
+    alpaka::kernel::exec<TAcc>(queue, workDiv, EmptyBlockKernel{}, &blockThreadSum);
+    auto const endT(std::chrono::high_resolution_clock::now());
+
+    std::cout
+        << std::setw(16) << std::left << name
+        << " blocks: " << std::setw(8) << std::right << gridBlockCount
+        << " threads: " << std::setw(4) << std::right << blockThreadCount
+        << " time per block: " << std::setw(12) << std::right << std::chrono::duration<double, std::nano>(endT - beginT).count() / static_cast<double>(gridBlockCount) << " ns"
+        << std::endl;
+}
+
+auto main(
+    int argc,
+    char * argv[])
+-> int
+{
+#if !defined(ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLED) && !defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED) && !defined(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED) && !defined(ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLED)
+    alpaka::ignore_unused(argc);
+    alpaka::ignore_unused(argv);
+    std::cout << "None of the CPU accelerators with multiple threads per block is enabled!" << std::endl;
+#else
+    std::size_t const gridBlockCount(argc > 1 ? std::stoul(argv[1]) : 10000u);
+
+    using Dim = alpaka::dim::DimInt<1u>;
+    using Idx = std::size_t;
+
+    for(std::size_t blockThreadCount : {1u, 2u, 4u, 8u})
+    {
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLED)
+        measureGridBlockOverhead<alpaka::acc::AccCpuOmp2Threads<Dim, Idx>>("omp2Threads", gridBlockCount, blockThreadCount);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+        measureGridBlockOverhead<alpaka::acc::AccCpuThreads<Dim, Idx>>("threads", gridBlockCount, blockThreadCount);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED)
+        measureGridBlockOverhead<alpaka::acc::AccCpuFibers<Dim, Idx>>("fibers", gridBlockCount, blockThreadCount);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLED)
+        measureGridBlockOverhead<alpaka::acc::AccCpuLanes<Dim, Idx>>("lanes", gridBlockCount, blockThreadCount);
+#endif
+    }
+#endif
+    return EXIT_SUCCESS;
+}
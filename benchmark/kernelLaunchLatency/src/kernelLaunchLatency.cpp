@@ -0,0 +1,151 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+//#############################################################################
+//! A kernel doing nothing so that only the launch overhead is measured.
+class EmptyKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc) const
+    -> void
+    {
+        alpaka::ignore_unused(acc);
+    }
+};
+
+//-----------------------------------------------------------------------------
+//! Enqueues the given function repeatedly and prints the median and mean time from enqueue until the queue is finished.
+template<
+    typename TQueue,
+    typename TFnObj>
+auto measureLaunchLatency(
+    std::string const & name,
+    TQueue & queue,
+    TFnObj const & enqueueFn,
+    std::size_t const numLaunches)
+-> void
+{
+    std::vector<double> latenciesUs;
+    latenciesUs.reserve(numLaunches);
+
+    // Warm up.
+    enqueueFn();
+    alpaka::wait::wait(queue);
+
+    for(std::size_t i(0u); i < numLaunches; ++i)
+    {
+        auto const beginT(std::chrono::high_resolution_clock::now());
+        enqueueFn();
+        alpaka::wait::wait(queue);
+        auto const endT(std::chrono::high_resolution_clock::now());
+        latenciesUs.push_back(std::chrono::duration<double, std::micro>(endT - beginT).count());
+    }
+
+    std::sort(latenciesUs.begin(), latenciesUs.end());
+    double sum(0.0);
+    for(auto const latency : latenciesUs)
+    {
+        sum += latency;
+    }
+
+    std::cout
+        << std::setw(56) << std::left << name
+        << " median: " << std::setw(10) << std::right << latenciesUs[latenciesUs.size() / 2u] << " us"
+        << " mean: " << std::setw(10) << std::right << sum / static_cast<double>(latenciesUs.size()) << " us"
+        << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+//! Compares launching a kernel on threads created for each launch with launching it on the thread pool owned by the device.
+template<
+    typename TQueueProperty>
+auto benchmarkQueue(
+    std::string const & queueName,
+    std::size_t const blockThreadCount,
+    std::size_t const numLaunches)
+-> void
+{
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+    using Dim = alpaka::dim::DimInt<1u>;
+    using Idx = std::size_t;
+    using Acc = alpaka::acc::AccCpuThreads<Dim, Idx>;
+    using Queue = alpaka::queue::Queue<Acc, TQueueProperty>;
+
+    auto const devAcc(alpaka::pltf::getDevByIdx<Acc>(0u));
+    Queue queue(devAcc);
+
+    alpaka::workdiv::WorkDivMembers<Dim, Idx> const workDiv(
+        static_cast<Idx>(4u),
+        static_cast<Idx>(blockThreadCount),
+        static_cast<Idx>(1u));
+
+    auto const taskKernel(alpaka::kernel::createTaskKernel<Acc>(workDiv, EmptyKernel{}));
+
+    std::string const suffix(" (" + queueName + ", " + std::to_string(blockThreadCount) + " threads)");
+
+    measureLaunchLatency(
+        "threads created per launch" + suffix,
+        queue,
+        [&]()
+        {
+            // Executed outside of a queue the task has no device to lease the threads from, so it creates its own threads.
+            taskKernel();
+        },
+        numLaunches);
+
+    measureLaunchLatency(
+        "device thread pool" + suffix,
+        queue,
+        [&]()
+        {
+            alpaka::queue::enqueue(queue, taskKernel);
+        },
+        numLaunches);
+#else
+    alpaka::ignore_unused(queueName);
+    alpaka::ignore_unused(blockThreadCount);
+    alpaka::ignore_unused(numLaunches);
+#endif
+}
+
+auto main(
+    int argc,
+    char * argv[])
+-> int
+{
+#if !defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+    alpaka::ignore_unused(argc);
+    alpaka::ignore_unused(argv);
+    std::cout << "The CPU threads accelerator is not enabled!" << std::endl;
+#else
+    std::size_t const numLaunches(argc > 1 ? std::stoul(argv[1]) : 1000u);
+
+    for(std::size_t blockThreadCount : {1u, 4u, 16u})
+    {
+        benchmarkQueue<alpaka::queue::Blocking>("blocking", blockThreadCount, numLaunches);
+        benchmarkQueue<alpaka::queue::NonBlocking>("non-blocking", blockThreadCount, numLaunches);
+    }
+#endif
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,132 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+//#############################################################################
+//! A kernel doing nothing so that only the launch overhead is measured.
+class EmptyKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc) const
+    -> void
+    {
+        alpaka::ignore_unused(acc);
+    }
+};
+
+//-----------------------------------------------------------------------------
+//! \return The given percentile of the sorted values.
+auto percentile(
+    std::vector<double> const & sortedValues,
+    double const p)
+-> double
+{
+    auto const idx(static_cast<std::size_t>(p * static_cast<double>(sortedValues.size() - 1u)));
+    return sortedValues[idx];
+}
+
+//-----------------------------------------------------------------------------
+//! Launches the kernel repeatedly into an idle queue and prints the percentiles of the time from the launch until the queue is finished.
+template<
+    typename TAcc,
+    typename TQueueProperty>
+auto measureLaunchToCompletionLatency(
+    std::string const & name,
+    std::size_t const gridBlockCount,
+    std::size_t const numLaunches)
+-> void
+{
+    using Dim = alpaka::dim::Dim<TAcc>;
+    using Idx = alpaka::idx::Idx<TAcc>;
+    using Queue = alpaka::queue::Queue<TAcc, TQueueProperty>;
+
+    auto const devAcc(alpaka::pltf::getDevByIdx<TAcc>(0u));
+    Queue queue(devAcc);
+
+    alpaka::workdiv::WorkDivMembers<Dim, Idx> const workDiv(
+        static_cast<Idx>(gridBlockCount),
+        static_cast<Idx>(1u),
+        static_cast<Idx>(1u));
+    auto const taskKernel(alpaka::kernel::createTaskKernel<TAcc>(workDiv, EmptyKernel{}));
+
+    // Warm up.
+    alpaka::queue::enqueue(queue, taskKernel);
+    alpaka::wait::wait(queue);
+
+    std::vector<double> latenciesUs;
+    latenciesUs.reserve(numLaunches);
+    for(std::size_t i(0u); i < numLaunches; ++i)
+    {
+        auto const beginT(std::chrono::high_resolution_clock::now());
+        alpaka::queue::enqueue(queue, taskKernel);
+        alpaka::wait::wait(queue);
+        auto const endT(std::chrono::high_resolution_clock::now());
+        latenciesUs.push_back(std::chrono::duration<double, std::micro>(endT - beginT).count());
+    }
+
+    std::sort(latenciesUs.begin(), latenciesUs.end());
+
+    std::cout
+        << std::setw(64) << std::left << (name + " (" + std::to_string(gridBlockCount) + " blocks)")
+        << " p50: " << std::setw(10) << std::right << percentile(latenciesUs, 0.5) << " us"
+        << " p99: " << std::setw(10) << std::right << percentile(latenciesUs, 0.99) << " us"
+        << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+//! Compares the non-blocking queue with the non-blocking queue executing cheap tasks inline while it is idle.
+template<
+    typename TAcc>
+auto benchmarkAcc(
+    std::size_t const numLaunches)
+-> void
+{
+    std::string const accName(alpaka::acc::getAccName<TAcc>());
+
+    // The first kernel is estimated to be cheap, the second one is not and therefore always executed asynchronously.
+    for(std::size_t gridBlockCount : {1u, 4096u})
+    {
+        measureLaunchToCompletionLatency<TAcc, alpaka::queue::NonBlocking>(accName + " non-blocking", gridBlockCount, numLaunches);
+        measureLaunchToCompletionLatency<TAcc, alpaka::queue::NonBlockingInline>(accName + " non-blocking inline", gridBlockCount, numLaunches);
+    }
+}
+
+auto main(
+    int argc,
+    char * argv[])
+-> int
+{
+    std::size_t const numLaunches(argc > 1 ? std::stoul(argv[1]) : 10000u);
+
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED)
+    benchmarkAcc<alpaka::acc::AccCpuSerial<alpaka::dim::DimInt<1u>, std::size_t>>(numLaunches);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+    benchmarkAcc<alpaka::acc::AccCpuThreads<alpaka::dim::DimInt<1u>, std::size_t>>(numLaunches);
+#endif
+#if !defined(ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED) && !defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+    alpaka::ignore_unused(numLaunches);
+    std::cout << "Neither the CPU serial nor the CPU threads accelerator is enabled!" << std::endl;
+#endif
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,156 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//#############################################################################
+//! A queue owning a single worker thread like the non-blocking CPU queue did before it used a shared executor.
+class DedicatedThreadQueue
+{
+    using ThreadPool =
+        alpaka::core::detail::ConcurrentExecPool<
+            std::size_t,
+            std::thread,
+            std::promise,
+            void,
+            std::mutex,
+            std::condition_variable,
+            false>;
+
+public:
+    //-----------------------------------------------------------------------------
+    explicit DedicatedThreadQueue(
+        alpaka::dev::DevCpu const &) :
+            m_upWorkerThread(std::make_unique<ThreadPool>(1u))
+    {}
+    //-----------------------------------------------------------------------------
+    template<
+        typename TTask>
+    auto enqueue(
+        TTask const & task)
+    -> void
+    {
+        m_upWorkerThread->enqueueTask(task);
+    }
+    //-----------------------------------------------------------------------------
+    auto wait()
+    -> void
+    {
+        m_upWorkerThread->enqueueTask([](){}).wait();
+    }
+
+private:
+    std::unique_ptr<ThreadPool> m_upWorkerThread;
+};
+
+//#############################################################################
+//! The non-blocking CPU queue.
+class NonBlockingQueue
+{
+public:
+    //-----------------------------------------------------------------------------
+    explicit NonBlockingQueue(
+        alpaka::dev::DevCpu const & dev) :
+            m_queue(dev)
+    {}
+    //-----------------------------------------------------------------------------
+    template<
+        typename TTask>
+    auto enqueue(
+        TTask const & task)
+    -> void
+    {
+        alpaka::queue::enqueue(m_queue, task);
+    }
+    //-----------------------------------------------------------------------------
+    auto wait()
+    -> void
+    {
+        alpaka::wait::wait(m_queue);
+    }
+
+private:
+    alpaka::queue::QueueCpuNonBlocking m_queue;
+};
+
+//-----------------------------------------------------------------------------
+//! Enqueues the given number of tasks round-robin into the given number of queues, waits for all queues and prints the number of tasks completed per second.
+template<
+    typename TQueue>
+auto measureQueueThroughput(
+    std::string const & name,
+    std::size_t const queueCount,
+    std::size_t const numTasks)
+-> void
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+
+    auto const beginCreateT(std::chrono::high_resolution_clock::now());
+    std::vector<std::unique_ptr<TQueue>> queues;
+    queues.reserve(queueCount);
+    for(std::size_t queueIdx(0u); queueIdx < queueCount; ++queueIdx)
+    {
+        queues.emplace_back(std::make_unique<TQueue>(dev));
+    }
+    auto const endCreateT(std::chrono::high_resolution_clock::now());
+
+    std::atomic<std::size_t> completedTaskCount(0u);
+    auto const task([&completedTaskCount](){++completedTaskCount;});
+
+    auto const beginT(std::chrono::high_resolution_clock::now());
+    for(std::size_t taskIdx(0u); taskIdx < numTasks; ++taskIdx)
+    {
+        queues[taskIdx % queueCount]->enqueue(task);
+    }
+    for(auto & upQueue : queues)
+    {
+        upQueue->wait();
+    }
+    auto const endT(std::chrono::high_resolution_clock::now());
+
+    auto const createDurationUs(std::chrono::duration<double, std::micro>(endCreateT - beginCreateT).count());
+    auto const durationS(std::chrono::duration<double>(endT - beginT).count());
+
+    std::cout
+        << std::setw(24) << std::left << name
+        << " queues: " << std::setw(5) << std::right << queueCount
+        << " creation per queue: " << std::setw(10) << std::right << createDurationUs / static_cast<double>(queueCount) << " us"
+        << " throughput: " << std::setw(12) << std::right << static_cast<double>(completedTaskCount.load()) / durationS << " tasks/s"
+        << std::endl;
+}
+
+auto main(
+    int argc,
+    char * argv[])
+-> int
+{
+    std::size_t const numTasks(argc > 1 ? std::stoul(argv[1]) : 100000u);
+
+    for(std::size_t queueCount : {1u, 16u, 256u, 1024u})
+    {
+        measureQueueThroughput<DedicatedThreadQueue>("thread per queue", queueCount, numTasks);
+        measureQueueThroughput<NonBlockingQueue>("shared executor", queueCount, numTasks);
+    }
+
+    return EXIT_SUCCESS;
+}
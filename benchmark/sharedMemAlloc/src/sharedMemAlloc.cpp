@@ -0,0 +1,143 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+//#############################################################################
+//! A kernel allocating several static shared memory tiles like a tiled matrix multiplication so that the allocation cost dominates.
+class SharedTilesKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        std::uint32_t * const pSum) const
+    -> void
+    {
+        using Tile = std::array<std::uint32_t, 64u>;
+
+        auto & tileA(alpaka::block::shared::st::allocVar<Tile, __COUNTER__>(acc));
+        auto & tileB(alpaka::block::shared::st::allocVar<Tile, __COUNTER__>(acc));
+        auto & tileC(alpaka::block::shared::st::allocVar<Tile, __COUNTER__>(acc));
+        auto & sum(alpaka::block::shared::st::allocVar<std::uint32_t, __COUNTER__>(acc));
+
+        auto const blockThreadIdx(static_cast<std::size_t>(alpaka::idx::getIdx<alpaka::Block, alpaka::Threads>(acc)[0u]));
+        if(blockThreadIdx == 0u)
+        {
+            tileA[0u] = 1u;
+            tileB[0u] = 2u;
+            tileC[0u] = tileA[0u] * tileB[0u];
+            sum = tileC[0u];
+        }
+        alpaka::block::sync::syncBlockThreads(acc);
+
+        if(blockThreadIdx == 0u)
+        {
+            alpaka::atomic::atomicOp<alpaka::atomic::op::Add>(
+                acc,
+                pSum,
+                sum,
+                alpaka::hierarchy::Blocks());
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------
+//! Executes a grid of many blocks allocating shared memory and prints the time per block.
+template<
+    typename TAcc>
+auto measureSharedMemAlloc(
+    std::string const & name,
+    std::size_t const gridBlockCount,
+    std::size_t const blockThreadCount)
+-> void
+{
+    using Dim = alpaka::dim::Dim<TAcc>;
+    using Idx = alpaka::idx::Idx<TAcc>;
+    using Queue = alpaka::queue::Queue<TAcc, alpaka::queue::Blocking>;
+
+    auto const devAcc(alpaka::pltf::getDevByIdx<TAcc>(0u));
+    Queue queue(devAcc);
+
+    auto const devProps(alpaka::acc::getAccDevProps<TAcc>(devAcc));
+    if(blockThreadCount > static_cast<std::size_t>(devProps.m_blockThreadCountMax))
+    {
+        return;
+    }
+
+    alpaka::workdiv::WorkDivMembers<Dim, Idx> const workDiv(
+        static_cast<Idx>(gridBlockCount),
+        static_cast<Idx>(blockThreadCount),
+        static_cast<Idx>(1u));
+
+    std::uint32_t sum(0u);
+
+    // Warm up so that the threads of the device already exist.
+    alpaka::kernel::exec<TAcc>(queue, workDiv, SharedTilesKernel{}, &sum);
+
+    auto const beginT(std::chrono::high_resolution_clock::now());
+    alpaka::kernel::exec<TAcc>(queue, workDiv, SharedTilesKernel{}, &sum);
+    auto const endT(std::chrono::high_resolution_clock::now());
+
+    std::cout
+        << std::setw(16) << std::left << name
+        << " blocks: " << std::setw(8) << std::right << gridBlockCount
+        << " threads: " << std::setw(4) << std::right << blockThreadCount
+        << " time per block: " << std::setw(12) << std::right << std::chrono::duration<double, std::nano>(endT - beginT).count() / static_cast<double>(gridBlockCount) << " ns"
+        << std::endl;
+}
+
+auto main(
+    int argc,
+    char * argv[])
+-> int
+{
+    std::size_t const gridBlockCount(argc > 1 ? std::stoul(argv[1]) : 10000u);
+
+    using Dim = alpaka::dim::DimInt<1u>;
+    using Idx = std::size_t;
+
+    alpaka::ignore_unused(gridBlockCount);
+
+    // The accelerators with a single thread per block serve as the baseline.
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED)
+    measureSharedMemAlloc<alpaka::acc::AccCpuSerial<Dim, Idx>>("serial", gridBlockCount, 1u);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED)
+    measureSharedMemAlloc<alpaka::acc::AccCpuOmp2Blocks<Dim, Idx>>("omp2Blocks", gridBlockCount, 1u);
+#endif
+    for(std::size_t blockThreadCount : {1u, 4u})
+    {
+        alpaka::ignore_unused(blockThreadCount);
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLED)
+        measureSharedMemAlloc<alpaka::acc::AccCpuOmp2Threads<Dim, Idx>>("omp2Threads", gridBlockCount, blockThreadCount);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+        measureSharedMemAlloc<alpaka::acc::AccCpuThreads<Dim, Idx>>("threads", gridBlockCount, blockThreadCount);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED)
+        measureSharedMemAlloc<alpaka::acc::AccCpuFibers<Dim, Idx>>("fibers", gridBlockCount, blockThreadCount);
+#endif
+#if defined(ALPAKA_ACC_CPU_BT_OMP4_ENABLED)
+        measureSharedMemAlloc<alpaka::acc::AccCpuOmp4<Dim, Idx>>("omp4", gridBlockCount, blockThreadCount);
+#endif
+    }
+    return EXIT_SUCCESS;
+}
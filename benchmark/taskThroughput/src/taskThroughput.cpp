@@ -0,0 +1,171 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/core/ConcurrentExecPool.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//#############################################################################
+struct ThreadPoolYield
+{
+    //-----------------------------------------------------------------------------
+    static auto yield()
+    -> void
+    {
+        std::this_thread::yield();
+    }
+};
+
+//#############################################################################
+//! The pool the CPU back-ends use, parametrized on the task queue.
+template<
+    template<typename TTask> class TTaskQueue>
+using ThreadPool =
+    alpaka::core::detail::ConcurrentExecPool<
+        std::size_t,
+        std::thread,
+        std::promise,
+        ThreadPoolYield,
+        std::mutex,
+        std::condition_variable,
+        false,
+        TTaskQueue>;
+
+//-----------------------------------------------------------------------------
+//! Enqueues one empty task per future.
+struct FutureTasks
+{
+    //-----------------------------------------------------------------------------
+    template<
+        typename TPool>
+    static auto enqueueAndWait(
+        TPool & pool,
+        std::size_t const numTasks)
+    -> void
+    {
+        std::vector<std::future<void>> futures;
+        futures.reserve(numTasks);
+        for(std::size_t i(0u); i < numTasks; ++i)
+        {
+            futures.emplace_back(pool.enqueueTask([](){}));
+        }
+        for(auto & future : futures)
+        {
+            future.wait();
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------
+//! Enqueues caller-owned empty tasks signaling a single latch.
+struct IntrusiveTasks
+{
+    //-----------------------------------------------------------------------------
+    template<
+        typename TPool>
+    static auto enqueueAndWait(
+        TPool & pool,
+        std::size_t const numTasks)
+    -> void
+    {
+        using Latch = alpaka::core::detail::CompletionLatch<std::mutex, std::condition_variable>;
+        auto emptyFn([](){});
+        using Task = alpaka::core::detail::IntrusiveTaskPkg<Latch, decltype(emptyFn)>;
+
+        Latch latch(numTasks);
+        std::vector<Task> tasks;
+        tasks.reserve(numTasks);
+        for(std::size_t i(0u); i < numTasks; ++i)
+        {
+            tasks.emplace_back(latch, decltype(emptyFn)(emptyFn));
+            pool.enqueueIntrusiveTask(tasks.back());
+        }
+        latch.wait();
+    }
+};
+
+//-----------------------------------------------------------------------------
+//! Enqueues the given number of empty tasks from the given number of producer threads and prints the number of tasks executed per second.
+template<
+    template<typename TTask> class TTaskQueue,
+    typename TTasks = FutureTasks>
+auto measureTaskThroughput(
+    std::string const & name,
+    std::size_t const workerCount,
+    std::size_t const producerCount,
+    std::size_t const numTasks)
+-> void
+{
+    ThreadPool<TTaskQueue> pool(workerCount);
+
+    auto const numTasksPerProducer(numTasks / producerCount);
+
+    auto const beginT(std::chrono::high_resolution_clock::now());
+    std::vector<std::thread> producers;
+    for(std::size_t producer(0u); producer < producerCount; ++producer)
+    {
+        producers.emplace_back(
+            [&pool, numTasksPerProducer]()
+            {
+                TTasks::enqueueAndWait(pool, numTasksPerProducer);
+            });
+    }
+    for(auto & producer : producers)
+    {
+        producer.join();
+    }
+    auto const endT(std::chrono::high_resolution_clock::now());
+
+    auto const durationS(std::chrono::duration<double>(endT - beginT).count());
+
+    std::cout
+        << std::setw(32) << std::left << name
+        << " workers: " << std::setw(4) << std::right << workerCount
+        << " producers: " << std::setw(4) << std::right << producerCount
+        << " throughput: " << std::setw(12) << std::right << static_cast<double>(numTasksPerProducer * producerCount) / durationS << " tasks/s"
+        << std::endl;
+}
+
+auto main(
+    int argc,
+    char * argv[])
+-> int
+{
+    std::size_t const numTasks(argc > 1 ? std::stoul(argv[1]) : 200000u);
+    std::size_t const maxWorkerCount(std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), static_cast<std::size_t>(1u)));
+
+    for(std::size_t workerCount(1u); workerCount <= maxWorkerCount; workerCount *= 2u)
+    {
+        // A single producer is the common case of a queue enqueueing the threads of a block.
+        // As many producers as workers model kernels from many queues sharing a pool.
+        for(std::size_t producerCount : {static_cast<std::size_t>(1u), workerCount})
+        {
+            measureTaskThroughput<alpaka::core::detail::ThreadSafeQueue>("locked queue", workerCount, producerCount, numTasks);
+            measureTaskThroughput<alpaka::core::detail::WorkStealingQueue>("work-stealing deques", workerCount, producerCount, numTasks);
+            measureTaskThroughput<alpaka::core::detail::ThreadSafeQueue, IntrusiveTasks>("locked queue, intrusive", workerCount, producerCount, numTasks);
+            measureTaskThroughput<alpaka::core::detail::WorkStealingQueue, IntrusiveTasks>("work-stealing deques, intrusive", workerCount, producerCount, numTasks);
+            if(workerCount == 1u)
+            {
+                break;
+            }
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
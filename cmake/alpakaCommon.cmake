@@ -51,6 +51,7 @@ endif()
 option(ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLE "Enable the serial CPU back-end" OFF)
 option(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLE "Enable the threads CPU block thread back-end" OFF)
 option(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE "Enable the fibers CPU block thread back-end" OFF)
+option(ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLE "Enable the lanes CPU block thread back-end" OFF)
 option(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLE "Enable the TBB CPU grid block back-end" OFF)
 option(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLE "Enable the OpenMP 2.0 CPU grid block back-end" OFF)
 option(ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLE "Enable the OpenMP 2.0 CPU block thread back-end" OFF)
@@ -63,6 +64,7 @@ if((ALPAKA_ACC_GPU_CUDA_ONLY_MODE OR ALPAKA_ACC_GPU_HIP_ONLY_MODE)
     (ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLE OR
     ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLE OR
     ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE OR
+    ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLE OR
     ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLE OR
     ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLE OR
     ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLE OR
@@ -107,6 +109,8 @@ endif()
 
 option(ALPAKA_DEBUG_OFFLOAD_ASSUME_HOST "Allow host-only contructs like assert in offload code in debug mode." ON)
 set(ALPAKA_BLOCK_SHARED_DYN_MEMBER_ALLOC_KIB "30" CACHE STRING "Kibibytes (1024B) of memory to allocate for block shared memory for backends requiring static allocation (includes CPU_B_OMP2_T_SEQ, CPU_B_TBB_T_SEQ, CPU_B_SEQ_T_SEQ)")
+set(ALPAKA_CPU_TBB_BLOCKS_GRAIN_SIZE "1" CACHE STRING "Minimum number of grid blocks executed as one chunk by a TBB worker in the CPU_B_TBB_T_SEQ back-end if the block schedule of the kernel does not specify a chunk size")
+option(ALPAKA_CPU_WORK_STEALING "Let the thread and fiber pools of the CPU back-ends use per-thread work-stealing deques instead of a single locked task queue" OFF)
 
 #-------------------------------------------------------------------------------
 # Debug output of common variables.
@@ -127,6 +131,9 @@ endif()
 if(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE AND (ALPAKA_ACC_GPU_CUDA_ENABLE OR ALPAKA_ACC_GPU_HIP_ENABLE))
     message(FATAL_ERROR "Fibers and CUDA or HIP back-end can not be enabled both at the same time.")
 endif()
+if(ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLE AND (ALPAKA_ACC_GPU_CUDA_ENABLE OR ALPAKA_ACC_GPU_HIP_ENABLE))
+    message(FATAL_ERROR "Lanes and CUDA or HIP back-end can not be enabled both at the same time.")
+endif()
 
 #-------------------------------------------------------------------------------
 # Compiler settings.
@@ -159,7 +166,7 @@ if(${ALPAKA_DEBUG} GREATER 1)
 endif()
 
 find_package(Boost ${_ALPAKA_BOOST_MIN_VER} REQUIRED
-             OPTIONAL_COMPONENTS fiber)
+             OPTIONAL_COMPONENTS fiber context)
 
 target_link_libraries(alpaka INTERFACE Boost::headers)
 
@@ -169,6 +176,12 @@ if(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE)
     endif()
 endif()
 
+if(ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLE)
+    if(NOT Boost_CONTEXT_FOUND)
+        message(FATAL_ERROR "Optional alpaka dependency Boost.Context could not be found!")
+    endif()
+endif()
+
 if(${ALPAKA_DEBUG} GREATER 1)
     message(STATUS "Boost in:")
     cmake_print_variables(BOOST_ROOT)
@@ -743,6 +756,18 @@ if(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE)
 
     message(STATUS ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED)
 endif()
+if(ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLE)
+    target_compile_definitions(alpaka INTERFACE "ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLED")
+
+    if(MSVC AND (${CMAKE_SIZEOF_VOID_P} EQUAL 4))
+        # On Win32 boost context triggers:
+        # libboost_context-vc141-mt-gd-1_64.lib(jump_i386_ms_pe_masm.obj) : error LNK2026: module unsafe for SAFESEH image.
+        target_link_options(Boost::context INTERFACE "/SAFESEH:NO")
+    endif()
+    target_link_libraries(alpaka INTERFACE Boost::context)
+
+    message(STATUS ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLED)
+endif()
 if(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLE)
     target_compile_definitions(alpaka INTERFACE "ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED")
     message(STATUS ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED)
@@ -777,6 +802,10 @@ if(ALPAKA_DEBUG_OFFLOAD_ASSUME_HOST)
    target_compile_definitions(alpaka INTERFACE "ALPAKA_DEBUG_OFFLOAD_ASSUME_HOST")
 endif()
 target_compile_definitions(alpaka INTERFACE "ALPAKA_BLOCK_SHARED_DYN_MEMBER_ALLOC_KIB=${ALPAKA_BLOCK_SHARED_DYN_MEMBER_ALLOC_KIB}")
+target_compile_definitions(alpaka INTERFACE "ALPAKA_CPU_TBB_BLOCKS_GRAIN_SIZE=${ALPAKA_CPU_TBB_BLOCKS_GRAIN_SIZE}")
+if(ALPAKA_CPU_WORK_STEALING)
+    target_compile_definitions(alpaka INTERFACE "ALPAKA_CPU_WORK_STEALING_ENABLED")
+endif()
 
 if(ALPAKA_CI)
     target_compile_definitions(alpaka INTERFACE "ALPAKA_CI")
@@ -14,7 +14,7 @@
 // Base classes.
 #include <alpaka/workdiv/WorkDivMembers.hpp>
 #include <alpaka/idx/gb/IdxGbRef.hpp>
-#include <alpaka/idx/bt/IdxBtRefFiberIdMap.hpp>
+#include <alpaka/idx/bt/IdxBtRefActiveFiber.hpp>
 #include <alpaka/atomic/AtomicNoOp.hpp>
 #include <alpaka/atomic/AtomicStdLibLock.hpp>
 #include <alpaka/atomic/AtomicHierarchy.hpp>
@@ -71,7 +71,7 @@ namespace alpaka
         class AccCpuFibers final :
             public workdiv::WorkDivMembers<TDim, TIdx>,
             public idx::gb::IdxGbRef<TDim, TIdx>,
-            public idx::bt::IdxBtRefFiberIdMap<TDim, TIdx>,
+            public idx::bt::IdxBtRefActiveFiber<TDim, TIdx>,
             public atomic::AtomicHierarchy<
                 atomic::AtomicStdLibLock<16>, // grid atomics
                 atomic::AtomicStdLibLock<16>, // block atomics
@@ -79,7 +79,7 @@ namespace alpaka
             >,
             public math::MathStdLib,
             public block::shared::dyn::BlockSharedMemDynAlignedAlloc,
-            public block::shared::st::BlockSharedMemStMasterSync,
+            public block::shared::st::BlockSharedMemStMasterSync<block::sync::BlockSyncBarrierFiber<TIdx>, idx::bt::IdxBtRefActiveFiber<TDim, TIdx>, false>,
             public block::sync::BlockSyncBarrierFiber<TIdx>,
             public intrinsic::IntrinsicCpu,
             public rand::RandStdLib,
@@ -105,7 +105,7 @@ namespace alpaka
                 TIdx const & blockSharedMemDynSizeBytes) :
                     workdiv::WorkDivMembers<TDim, TIdx>(workDiv),
                     idx::gb::IdxGbRef<TDim, TIdx>(m_gridBlockIdx),
-                    idx::bt::IdxBtRefFiberIdMap<TDim, TIdx>(m_fibersToIndices),
+                    idx::bt::IdxBtRefActiveFiber<TDim, TIdx>(m_activeFiberIdx),
                     atomic::AtomicHierarchy<
                         atomic::AtomicStdLibLock<16>, // atomics between grids
                         atomic::AtomicStdLibLock<16>, // atomics between blocks
@@ -113,14 +113,17 @@ namespace alpaka
                     >(),
                     math::MathStdLib(),
                     block::shared::dyn::BlockSharedMemDynAlignedAlloc(static_cast<std::size_t>(blockSharedMemDynSizeBytes)),
-                    block::shared::st::BlockSharedMemStMasterSync(
-                        [this](){block::sync::syncBlockThreads(*this);},
-                        [this](){return (m_masterFiberId == boost::this_fiber::get_id());}),
+                    // The fibers of a block are cooperatively scheduled so they can not busy wait for the master fiber.
+                    block::shared::st::BlockSharedMemStMasterSync<block::sync::BlockSyncBarrierFiber<TIdx>, idx::bt::IdxBtRefActiveFiber<TDim, TIdx>, false>(
+                        *this,
+                        *this),
                     block::sync::BlockSyncBarrierFiber<TIdx>(
-                        workdiv::getWorkDiv<Block, Threads>(workDiv).prod()),
+                        workdiv::getWorkDiv<Block, Threads>(workDiv).prod(),
+                        m_activeFiberIdx),
                     rand::RandStdLib(),
                     time::TimeStdLib(),
-                    m_gridBlockIdx(vec::Vec<TDim, TIdx>::zeros())
+                    m_gridBlockIdx(vec::Vec<TDim, TIdx>::zeros()),
+                    m_activeFiberIdx(static_cast<TIdx>(0u))
             {}
 
         public:
@@ -137,11 +140,8 @@ namespace alpaka
 
         private:
             // getIdx
-            typename idx::bt::IdxBtRefFiberIdMap<TDim, TIdx>::FiberIdToIdxMap mutable m_fibersToIndices;  //!< The mapping of fibers id's to indices.
             vec::Vec<TDim, TIdx> mutable m_gridBlockIdx;                    //!< The index of the currently executed block.
-
-            // allocBlockSharedArr
-            boost::fibers::fiber::id mutable m_masterFiberId;           //!< The id of the master fiber.
+            TIdx mutable m_activeFiberIdx;                                  //!< The linear index of the block thread executed by the running fiber.
         };
     }
 
@@ -0,0 +1,324 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#ifdef ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLED
+
+// Base classes.
+#include <alpaka/workdiv/WorkDivMembers.hpp>
+#include <alpaka/idx/gb/IdxGbRef.hpp>
+#include <alpaka/idx/bt/IdxBtRefActiveFiber.hpp>
+#include <alpaka/atomic/AtomicNoOp.hpp>
+#include <alpaka/atomic/AtomicStdLibLock.hpp>
+#include <alpaka/atomic/AtomicHierarchy.hpp>
+#include <alpaka/math/MathStdLib.hpp>
+#include <alpaka/block/shared/dyn/BlockSharedMemDynAlignedAlloc.hpp>
+#include <alpaka/block/shared/st/BlockSharedMemStMasterSync.hpp>
+#include <alpaka/block/sync/BlockSyncBarrierLane.hpp>
+#include <alpaka/intrinsic/IntrinsicCpu.hpp>
+#include <alpaka/rand/RandStdLib.hpp>
+#include <alpaka/time/TimeStdLib.hpp>
+#include <alpaka/warp/WarpSingleThread.hpp>
+
+// Specialized traits.
+#include <alpaka/acc/Traits.hpp>
+#include <alpaka/dev/Traits.hpp>
+#include <alpaka/kernel/Traits.hpp>
+#include <alpaka/pltf/Traits.hpp>
+#include <alpaka/idx/Traits.hpp>
+
+// Implementation details.
+#include <alpaka/core/ClipCast.hpp>
+#include <alpaka/core/Concepts.hpp>
+#include <alpaka/core/LaneScheduler.hpp>
+#include <alpaka/core/Unused.hpp>
+#include <alpaka/dev/DevCpu.hpp>
+
+#include <memory>
+#include <thread>
+#include <typeinfo>
+
+namespace alpaka
+{
+    namespace kernel
+    {
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TKernelFnObj,
+            typename... TArgs>
+        class TaskKernelCpuLanes;
+    }
+    namespace acc
+    {
+        //#############################################################################
+        //! The CPU lanes accelerator.
+        //!
+        //! This accelerator allows parallel kernel execution on a CPU device.
+        //! The threads of a block are executed like the lanes of GPU warps on a single core.
+        //! Each block thread runs on its own stack until it reaches a block synchronization or a warp collective operation and then switches to the next block thread.
+        //! The code between two synchronization points is thereby executed for all block threads in turn, which is the dynamic equivalent of splitting the kernel into loops over the block threads at the synchronization points.
+        //! The switches only save and restore registers, so kernels with many threads per block run much faster than with one fiber or operating system thread per block thread.
+        //! The warps consist of a single thread like on all other CPU accelerators, because the warp size is a property of the CPU device shared by them, see dev::getWarpSize.
+        template<
+            typename TDim,
+            typename TIdx>
+        class AccCpuLanes final :
+            public workdiv::WorkDivMembers<TDim, TIdx>,
+            // The scheduler is constructed before the bases referencing it.
+            private core::detail::LaneScheduler<TIdx>,
+            public idx::gb::IdxGbRef<TDim, TIdx>,
+            public idx::bt::IdxBtRefActiveFiber<TDim, TIdx>,
+            public atomic::AtomicHierarchy<
+                atomic::AtomicStdLibLock<16>, // grid atomics
+                atomic::AtomicNoOp,        // block atomics
+                atomic::AtomicNoOp         // thread atomics
+            >,
+            public math::MathStdLib,
+            public block::shared::dyn::BlockSharedMemDynAlignedAlloc,
+            public block::shared::st::BlockSharedMemStMasterSync<block::sync::BlockSyncBarrierLane<TIdx>, idx::bt::IdxBtRefActiveFiber<TDim, TIdx>, false>,
+            public block::sync::BlockSyncBarrierLane<TIdx>,
+            public intrinsic::IntrinsicCpu,
+            public rand::RandStdLib,
+            public time::TimeStdLib,
+            public warp::WarpSingleThread,
+            public concepts::Implements<ConceptAcc, AccCpuLanes<TDim, TIdx>>
+        {
+        public:
+            // Partial specialization with the correct TDim and TIdx is not allowed.
+            template<
+                typename TDim2,
+                typename TIdx2,
+                typename TKernelFnObj,
+                typename... TArgs>
+            friend class ::alpaka::kernel::TaskKernelCpuLanes;
+
+        private:
+            //-----------------------------------------------------------------------------
+            template<
+                typename TWorkDiv>
+            ALPAKA_FN_HOST AccCpuLanes(
+                TWorkDiv const & workDiv,
+                TIdx const & blockSharedMemDynSizeBytes) :
+                    workdiv::WorkDivMembers<TDim, TIdx>(workDiv),
+                    core::detail::LaneScheduler<TIdx>(),
+                    idx::gb::IdxGbRef<TDim, TIdx>(m_gridBlockIdx),
+                    idx::bt::IdxBtRefActiveFiber<TDim, TIdx>(this->m_activeLaneIdx),
+                    atomic::AtomicHierarchy<
+                        atomic::AtomicStdLibLock<16>, // atomics between grids
+                        atomic::AtomicNoOp,        // atomics between blocks
+                        atomic::AtomicNoOp         // atomics between threads
+                    >(),
+                    math::MathStdLib(),
+                    block::shared::dyn::BlockSharedMemDynAlignedAlloc(static_cast<std::size_t>(blockSharedMemDynSizeBytes)),
+                    // The block threads are cooperatively scheduled so they can not busy wait for the master thread.
+                    block::shared::st::BlockSharedMemStMasterSync<block::sync::BlockSyncBarrierLane<TIdx>, idx::bt::IdxBtRefActiveFiber<TDim, TIdx>, false>(
+                        *this,
+                        *this),
+                    block::sync::BlockSyncBarrierLane<TIdx>(
+                        workdiv::getWorkDiv<Block, Threads>(workDiv).prod(),
+                        *this),
+                    rand::RandStdLib(),
+                    time::TimeStdLib(),
+                    warp::WarpSingleThread(),
+                    m_gridBlockIdx(vec::Vec<TDim, TIdx>::zeros())
+            {}
+
+        public:
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST AccCpuLanes(AccCpuLanes const &) = delete;
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST AccCpuLanes(AccCpuLanes &&) = delete;
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator=(AccCpuLanes const &) -> AccCpuLanes & = delete;
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator=(AccCpuLanes &&) -> AccCpuLanes & = delete;
+            //-----------------------------------------------------------------------------
+            /*virtual*/ ~AccCpuLanes() = default;
+
+        private:
+            // getIdx
+            vec::Vec<TDim, TIdx> mutable m_gridBlockIdx;                    //!< The index of the currently executed block.
+        };
+    }
+
+    namespace acc
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU lanes accelerator accelerator type trait specialization.
+            template<
+                typename TDim,
+                typename TIdx>
+            struct AccType<
+                acc::AccCpuLanes<TDim, TIdx>>
+            {
+                using type = acc::AccCpuLanes<TDim, TIdx>;
+            };
+            //#############################################################################
+            //! The CPU lanes accelerator device properties get trait specialization.
+            template<
+                typename TDim,
+                typename TIdx>
+            struct GetAccDevProps<
+                acc::AccCpuLanes<TDim, TIdx>>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto getAccDevProps(
+                    dev::DevCpu const & dev)
+                -> alpaka::acc::AccDevProps<TDim, TIdx>
+                {
+#ifdef ALPAKA_CI
+                    auto const blockThreadCountMax(static_cast<TIdx>(8));
+#else
+                    // The block threads only require a stack each, so GPU-sized blocks are supported.
+                    auto const blockThreadCountMax(static_cast<TIdx>(1024));
+#endif
+                    return {
+                        // m_multiProcessorCount
+                        std::max(static_cast<TIdx>(1), alpaka::core::clipCast<TIdx>(std::thread::hardware_concurrency())),   // \TODO: This may be inaccurate.
+                        // m_gridBlockExtentMax
+                        vec::Vec<TDim, TIdx>::all(std::numeric_limits<TIdx>::max()),
+                        // m_gridBlockCountMax
+                        std::numeric_limits<TIdx>::max(),
+                        // m_blockThreadExtentMax
+                        vec::Vec<TDim, TIdx>::all(blockThreadCountMax),
+                        // m_blockThreadCountMax
+                        blockThreadCountMax,
+                        // m_threadElemExtentMax
+                        vec::Vec<TDim, TIdx>::all(std::numeric_limits<TIdx>::max()),
+                        // m_threadElemCountMax
+                        std::numeric_limits<TIdx>::max(),
+                        // m_sharedMemSizeBytes
+                        dev::getMemBytes( dev )};
+                }
+            };
+            //#############################################################################
+            //! The CPU lanes accelerator name trait specialization.
+            template<
+                typename TDim,
+                typename TIdx>
+            struct GetAccName<
+                acc::AccCpuLanes<TDim, TIdx>>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto getAccName()
+                -> std::string
+                {
+                    return "AccCpuLanes<" + std::to_string(TDim::value) + "," + typeid(TIdx).name() + ">";
+                }
+            };
+        }
+    }
+    namespace dev
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU lanes accelerator device type trait specialization.
+            template<
+                typename TDim,
+                typename TIdx>
+            struct DevType<
+                acc::AccCpuLanes<TDim, TIdx>>
+            {
+                using type = dev::DevCpu;
+            };
+        }
+    }
+    namespace dim
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU lanes accelerator dimension getter trait specialization.
+            template<
+                typename TDim,
+                typename TIdx>
+            struct DimType<
+                acc::AccCpuLanes<TDim, TIdx>>
+            {
+                using type = TDim;
+            };
+        }
+    }
+    namespace kernel
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU lanes accelerator execution task type trait specialization.
+            template<
+                typename TDim,
+                typename TIdx,
+                typename TWorkDiv,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct CreateTaskKernel<
+                acc::AccCpuLanes<TDim, TIdx>,
+                TWorkDiv,
+                TKernelFnObj,
+                TArgs...>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto createTaskKernel(
+                    TWorkDiv const & workDiv,
+                    TKernelFnObj const & kernelFnObj,
+                    TArgs && ... args)
+                {
+                    return
+                        kernel::TaskKernelCpuLanes<
+                            TDim,
+                            TIdx,
+                            TKernelFnObj,
+                            TArgs...>(
+                                workDiv,
+                                kernelFnObj,
+                                std::forward<TArgs>(args)...);
+                }
+            };
+        }
+    }
+    namespace pltf
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU lanes execution task platform type trait specialization.
+            template<
+                typename TDim,
+                typename TIdx>
+            struct PltfType<
+                acc::AccCpuLanes<TDim, TIdx>>
+            {
+                using type = pltf::PltfCpu;
+            };
+        }
+    }
+    namespace idx
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU lanes accelerator idx type trait specialization.
+            template<
+                typename TDim,
+                typename TIdx>
+            struct IdxType<
+                acc::AccCpuLanes<TDim, TIdx>>
+            {
+                using type = TIdx;
+            };
+        }
+    }
+}
+
+#endif
@@ -81,7 +81,7 @@ namespace alpaka
             >,
             public math::MathStdLib,
             public block::shared::dyn::BlockSharedMemDynAlignedAlloc,
-            public block::shared::st::BlockSharedMemStMasterSync,
+            public block::shared::st::BlockSharedMemStMasterSync<block::sync::BlockSyncBarrierOmp, idx::bt::IdxBtOmp<TDim, TIdx>>,
             public block::sync::BlockSyncBarrierOmp,
             public intrinsic::IntrinsicCpu,
             public rand::RandStdLib,
@@ -115,9 +115,9 @@ namespace alpaka
                     >(),
                     math::MathStdLib(),
                     block::shared::dyn::BlockSharedMemDynAlignedAlloc(static_cast<std::size_t>(blockSharedMemDynSizeBytes)),
-                    block::shared::st::BlockSharedMemStMasterSync(
-                        [this](){block::sync::syncBlockThreads(*this);},
-                        [](){return (::omp_get_thread_num() == 0);}),
+                    block::shared::st::BlockSharedMemStMasterSync<block::sync::BlockSyncBarrierOmp, idx::bt::IdxBtOmp<TDim, TIdx>>(
+                        *this,
+                        *this),
                     block::sync::BlockSyncBarrierOmp(),
                     rand::RandStdLib(),
                     time::TimeOmp(),
@@ -14,7 +14,7 @@
 // Base classes.
 #include <alpaka/workdiv/WorkDivMembers.hpp>
 #include <alpaka/idx/gb/IdxGbRef.hpp>
-#include <alpaka/idx/bt/IdxBtRefThreadIdMap.hpp>
+#include <alpaka/idx/bt/IdxBtThreadLocal.hpp>
 #include <alpaka/atomic/AtomicStdLibLock.hpp>
 #include <alpaka/atomic/AtomicHierarchy.hpp>
 #include <alpaka/math/MathStdLib.hpp>
@@ -68,7 +68,7 @@ namespace alpaka
         class AccCpuThreads final :
             public workdiv::WorkDivMembers<TDim, TIdx>,
             public idx::gb::IdxGbRef<TDim, TIdx>,
-            public idx::bt::IdxBtRefThreadIdMap<TDim, TIdx>,
+            public idx::bt::IdxBtThreadLocal<TDim, TIdx>,
             public atomic::AtomicHierarchy<
                 atomic::AtomicStdLibLock<16>, // grid atomics
                 atomic::AtomicStdLibLock<16>, // block atomics
@@ -76,7 +76,7 @@ namespace alpaka
             >,
             public math::MathStdLib,
             public block::shared::dyn::BlockSharedMemDynAlignedAlloc,
-            public block::shared::st::BlockSharedMemStMasterSync,
+            public block::shared::st::BlockSharedMemStMasterSync<block::sync::BlockSyncBarrierThread<TIdx>, idx::bt::IdxBtThreadLocal<TDim, TIdx>>,
             public block::sync::BlockSyncBarrierThread<TIdx>,
             public intrinsic::IntrinsicCpu,
             public rand::RandStdLib,
@@ -102,7 +102,7 @@ namespace alpaka
                 TIdx const & blockSharedMemDynSizeBytes) :
                     workdiv::WorkDivMembers<TDim, TIdx>(workDiv),
                     idx::gb::IdxGbRef<TDim, TIdx>(m_gridBlockIdx),
-                    idx::bt::IdxBtRefThreadIdMap<TDim, TIdx>(m_threadToIndexMap),
+                    idx::bt::IdxBtThreadLocal<TDim, TIdx>(),
                     atomic::AtomicHierarchy<
                         atomic::AtomicStdLibLock<16>, // atomics between grids
                         atomic::AtomicStdLibLock<16>, // atomics between blocks
@@ -110,9 +110,9 @@ namespace alpaka
                     >(),
                     math::MathStdLib(),
                     block::shared::dyn::BlockSharedMemDynAlignedAlloc(static_cast<std::size_t>(blockSharedMemDynSizeBytes)),
-                    block::shared::st::BlockSharedMemStMasterSync(
-                        [this](){block::sync::syncBlockThreads(*this);},
-                        [this](){return (m_idMasterThread == std::this_thread::get_id());}),
+                    block::shared::st::BlockSharedMemStMasterSync<block::sync::BlockSyncBarrierThread<TIdx>, idx::bt::IdxBtThreadLocal<TDim, TIdx>>(
+                        *this,
+                        *this),
                     block::sync::BlockSyncBarrierThread<TIdx>(
                         workdiv::getWorkDiv<Block, Threads>(workDiv).prod()),
                     rand::RandStdLib(),
@@ -134,12 +134,7 @@ namespace alpaka
 
         private:
             // getIdx
-            std::mutex mutable m_mtxMapInsert;                              //!< The mutex used to secure insertion into the ThreadIdToIdxMap.
-            typename idx::bt::IdxBtRefThreadIdMap<TDim, TIdx>::ThreadIdToIdxMap mutable m_threadToIndexMap;    //!< The mapping of thread id's to indices.
             vec::Vec<TDim, TIdx> mutable m_gridBlockIdx;                   //!< The index of the currently executed block.
-
-            // allocBlockSharedArr
-            std::thread::id mutable m_idMasterThread;                       //!< The id of the master thread.
         };
     }
 
@@ -21,6 +21,7 @@
 #include <alpaka/acc/AccCpuSerial.hpp>
 #include <alpaka/acc/AccCpuThreads.hpp>
 #include <alpaka/acc/AccCpuFibers.hpp>
+#include <alpaka/acc/AccCpuLanes.hpp>
 #include <alpaka/acc/AccCpuTbbBlocks.hpp>
 #include <alpaka/acc/AccCpuOmp2Blocks.hpp>
 #include <alpaka/acc/AccCpuOmp2Threads.hpp>
@@ -32,7 +33,9 @@
 #include <alpaka/acc/Traits.hpp>
 //-----------------------------------------------------------------------------
 // atomic
+#include <alpaka/atomic/AtomicBlockAggregator.hpp>
 #include <alpaka/atomic/AtomicUniformCudaHipBuiltIn.hpp>
+#include <alpaka/atomic/AtomicLockFree.hpp>
 #include <alpaka/atomic/AtomicNoOp.hpp>
 #include <alpaka/atomic/AtomicOmpBuiltIn.hpp>
 #include <alpaka/atomic/AtomicStdLibLock.hpp>
@@ -58,6 +61,7 @@
     //-----------------------------------------------------------------------------
     // sync
     #include <alpaka/block/sync/BlockSyncBarrierFiber.hpp>
+    #include <alpaka/block/sync/BlockSyncBarrierLane.hpp>
     #include <alpaka/block/sync/BlockSyncBarrierOmp.hpp>
     #include <alpaka/block/sync/BlockSyncBarrierThread.hpp>
     #include <alpaka/block/sync/BlockSyncUniformCudaHipBuiltIn.hpp>
@@ -78,7 +82,10 @@
 #include <alpaka/core/Debug.hpp>
 #include <alpaka/core/Fibers.hpp>
 #include <alpaka/core/Hip.hpp>
+#include <alpaka/core/LaneScheduler.hpp>
+#include <alpaka/core/LatencyMetrics.hpp>
 #include <alpaka/core/Positioning.hpp>
+#include <alpaka/core/StrandExecutor.hpp>
 #include <alpaka/core/Unroll.hpp>
 #include <alpaka/core/Unused.hpp>
 #include <alpaka/core/Utility.hpp>
@@ -103,11 +110,15 @@
 // extent
 #include <alpaka/extent/Traits.hpp>
 //-----------------------------------------------------------------------------
+// graph
+#include <alpaka/graph/GraphCpu.hpp>
+#include <alpaka/graph/QueueCpuCapture.hpp>
+//-----------------------------------------------------------------------------
 // idx
 #include <alpaka/idx/bt/IdxBtUniformCudaHipBuiltIn.hpp>
 #include <alpaka/idx/bt/IdxBtOmp.hpp>
-#include <alpaka/idx/bt/IdxBtRefFiberIdMap.hpp>
-#include <alpaka/idx/bt/IdxBtRefThreadIdMap.hpp>
+#include <alpaka/idx/bt/IdxBtRefActiveFiber.hpp>
+#include <alpaka/idx/bt/IdxBtThreadLocal.hpp>
 #include <alpaka/idx/bt/IdxBtZero.hpp>
 #include <alpaka/idx/gb/IdxGbUniformCudaHipBuiltIn.hpp>
 #include <alpaka/idx/gb/IdxGbRef.hpp>
@@ -116,9 +127,11 @@
 #include <alpaka/idx/MapIdx.hpp>
 //-----------------------------------------------------------------------------
 // kernel
+#include <alpaka/kernel/GridBlockTraversal.hpp>
 #include <alpaka/kernel/TaskKernelCpuSerial.hpp>
 #include <alpaka/kernel/TaskKernelCpuThreads.hpp>
 #include <alpaka/kernel/TaskKernelCpuFibers.hpp>
+#include <alpaka/kernel/TaskKernelCpuLanes.hpp>
 #include <alpaka/kernel/TaskKernelCpuTbbBlocks.hpp>
 #include <alpaka/kernel/TaskKernelCpuOmp2Blocks.hpp>
 #include <alpaka/kernel/TaskKernelCpuOmp2Threads.hpp>
@@ -184,8 +197,10 @@
 #include <alpaka/queue/QueueUniformCudaHipRtBlocking.hpp>
 #include <alpaka/queue/QueueCpuNonBlocking.hpp>
 #include <alpaka/queue/QueueCpuBlocking.hpp>
+#include <alpaka/queue/QueueCpuOutOfOrder.hpp>
 #include <alpaka/queue/Traits.hpp>
 #include <alpaka/queue/Properties.hpp>
+#include <alpaka/queue/TaskWithDependencies.hpp>
 //-----------------------------------------------------------------------------
 // time
 #include <alpaka/time/Traits.hpp>
@@ -0,0 +1,244 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/atomic/Op.hpp>
+#include <alpaka/atomic/Traits.hpp>
+#include <alpaka/block/shared/st/Traits.hpp>
+#include <alpaka/block/sync/Traits.hpp>
+#include <alpaka/dim/Traits.hpp>
+#include <alpaka/idx/Accessors.hpp>
+#include <alpaka/idx/Traits.hpp>
+#include <alpaka/vec/Vec.hpp>
+#include <alpaka/workdiv/Traits.hpp>
+
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Positioning.hpp>
+
+#include <limits>
+
+namespace alpaka
+{
+    namespace atomic
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! Describes how the contributions to an atomic operation are combined before the operation is executed once.
+            //!
+            //! The contributions are combined with CombineOp starting with the identity value.
+            //! Only the operations which are associative and commutative can be combined.
+            template<
+                typename TOp>
+            struct AtomicAggregation;
+            //#############################################################################
+            template<>
+            struct AtomicAggregation<
+                op::Add>
+            {
+                using CombineOp = op::Add;
+                //-----------------------------------------------------------------------------
+                template<
+                    typename T>
+                ALPAKA_FN_HOST_ACC static auto identity()
+                -> T
+                {
+                    return static_cast<T>(0);
+                }
+            };
+            //#############################################################################
+            //! Subtracting the contributions one by one is the same as subtracting their sum.
+            template<>
+            struct AtomicAggregation<
+                op::Sub>
+            {
+                using CombineOp = op::Add;
+                //-----------------------------------------------------------------------------
+                template<
+                    typename T>
+                ALPAKA_FN_HOST_ACC static auto identity()
+                -> T
+                {
+                    return static_cast<T>(0);
+                }
+            };
+            //#############################################################################
+            template<>
+            struct AtomicAggregation<
+                op::Min>
+            {
+                using CombineOp = op::Min;
+                //-----------------------------------------------------------------------------
+                template<
+                    typename T>
+                ALPAKA_FN_HOST_ACC static auto identity()
+                -> T
+                {
+                    return std::numeric_limits<T>::max();
+                }
+            };
+            //#############################################################################
+            template<>
+            struct AtomicAggregation<
+                op::Max>
+            {
+                using CombineOp = op::Max;
+                //-----------------------------------------------------------------------------
+                template<
+                    typename T>
+                ALPAKA_FN_HOST_ACC static auto identity()
+                -> T
+                {
+                    return std::numeric_limits<T>::lowest();
+                }
+            };
+            //#############################################################################
+            template<>
+            struct AtomicAggregation<
+                op::And>
+            {
+                using CombineOp = op::And;
+                //-----------------------------------------------------------------------------
+                template<
+                    typename T>
+                ALPAKA_FN_HOST_ACC static auto identity()
+                -> T
+                {
+                    return static_cast<T>(~static_cast<T>(0));
+                }
+            };
+            //#############################################################################
+            template<>
+            struct AtomicAggregation<
+                op::Or>
+            {
+                using CombineOp = op::Or;
+                //-----------------------------------------------------------------------------
+                template<
+                    typename T>
+                ALPAKA_FN_HOST_ACC static auto identity()
+                -> T
+                {
+                    return static_cast<T>(0);
+                }
+            };
+            //#############################################################################
+            template<>
+            struct AtomicAggregation<
+                op::Xor>
+            {
+                using CombineOp = op::Xor;
+                //-----------------------------------------------------------------------------
+                template<
+                    typename T>
+                ALPAKA_FN_HOST_ACC static auto identity()
+                -> T
+                {
+                    return static_cast<T>(0);
+                }
+            };
+        }
+
+        //#############################################################################
+        //! Combines the atomic operations of all threads of a block on the same address into a single atomic operation.
+        //!
+        //! The contributions of the threads are combined in block shared memory with atomics of the threads hierarchy level.
+        //! Afterwards one thread executes the operation on the address with the given hierarchy level.
+        //! This reduces the contention on counters updated by all threads of a grid.
+        //! Blocks with a single thread execute the operation directly.
+        //!
+        //! The aggregator has to be created and used by all threads of a block and the address has to be the same for all of them.
+        //! Only the associative and commutative operations Add, Sub, Min, Max, And, Or and Xor are supported.
+        //!
+        //! \tparam TOp The operation type.
+        //! \tparam T The value type.
+        template<
+            typename TOp,
+            typename T>
+        class AtomicBlockAggregator
+        {
+            using Aggregation = detail::AtomicAggregation<TOp>;
+
+            //#############################################################################
+            struct Storage
+            {
+                T m_accumulator;    //!< The combined contributions of the threads of the block.
+                T m_old;            //!< The old value returned by the aggregated operation.
+            };
+
+        public:
+            //-----------------------------------------------------------------------------
+            //! Allocates the block shared memory used to combine the contributions.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename TAcc>
+            ALPAKA_FN_ACC AtomicBlockAggregator(
+                TAcc const & acc) :
+                    m_storage(block::shared::st::allocVar<Storage, __COUNTER__>(acc)),
+                    m_isMasterThread(
+                        idx::getIdx<Block, Threads>(acc) == vec::Vec<dim::Dim<TAcc>, idx::Idx<TAcc>>::zeros()),
+                    m_isSingleThreadBlock(
+                        workdiv::getWorkDiv<Block, Threads>(acc).prod() == static_cast<idx::Idx<TAcc>>(1u))
+            {
+                if(m_isMasterThread)
+                {
+                    m_storage.m_accumulator = Aggregation::template identity<T>();
+                }
+                block::sync::syncBlockThreads(acc);
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Executes the operation for all threads of the block.
+            //!
+            //! \param addr The value to change atomically. It has to be the same for all threads of the block.
+            //! \param value The value used in the atomic operation by the calling thread.
+            //! \return The old value of addr as if the operations of the threads of the block had been executed atomically one after the other.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename TAcc,
+                typename THierarchy = hierarchy::Grids>
+            ALPAKA_FN_ACC auto operator()(
+                TAcc const & acc,
+                T * const addr,
+                T const & value,
+                THierarchy const & = THierarchy()) const
+            -> T
+            {
+                if(m_isSingleThreadBlock)
+                {
+                    return atomic::atomicOp<TOp>(acc, addr, value, THierarchy());
+                }
+
+                // The combined contributions of the threads before the calling one.
+                auto const blockOld(
+                    atomic::atomicOp<typename Aggregation::CombineOp>(acc, &m_storage.m_accumulator, value, hierarchy::Threads()));
+                block::sync::syncBlockThreads(acc);
+
+                // The accumulator is reset for the next operation while the other threads wait.
+                if(m_isMasterThread)
+                {
+                    m_storage.m_old = atomic::atomicOp<TOp>(acc, addr, m_storage.m_accumulator, THierarchy());
+                    m_storage.m_accumulator = Aggregation::template identity<T>();
+                }
+                block::sync::syncBlockThreads(acc);
+
+                // Apply the contributions of the threads before the calling one to the old value.
+                T old(m_storage.m_old);
+                TOp()(&old, blockOld);
+                return old;
+            }
+
+        private:
+            Storage & m_storage;
+            bool const m_isMasterThread;
+            bool const m_isSingleThreadBlock;
+        };
+    }
+}
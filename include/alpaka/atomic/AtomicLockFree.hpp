@@ -0,0 +1,208 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/atomic/Op.hpp>
+
+#include <alpaka/core/BoostPredef.hpp>
+#include <alpaka/core/Common.hpp>
+
+#include <cstring>
+#include <type_traits>
+
+namespace alpaka
+{
+    namespace atomic
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! Whether the atomic operations on values of type T can be executed lock-free in place.
+            template<
+                typename T>
+            struct IsAtomicLockFree : std::integral_constant<
+                bool,
+#if BOOST_COMP_GNUC || BOOST_COMP_CLANG
+                (std::is_integral<T>::value || std::is_floating_point<T>::value)
+                && !std::is_same<T, bool>::value
+                && (alignof(T) >= sizeof(T))
+                && __atomic_always_lock_free(sizeof(T), nullptr)>
+#else
+                false>
+#endif
+            {};
+
+#if BOOST_COMP_GNUC || BOOST_COMP_CLANG
+            //#############################################################################
+            //! The lock-free atomic operation.
+            //!
+            //! By default the operation is applied to a copy of the value which is written back with a compare-and-swap loop.
+            template<
+                typename TOp,
+                typename T,
+                typename TSfinae = void>
+            struct AtomicOpLockFree
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto atomicOp(
+                    T * const addr,
+                    T const & value)
+                -> T
+                {
+                    T old;
+                    __atomic_load(addr, &old, __ATOMIC_ACQUIRE);
+                    T desired;
+                    do
+                    {
+                        desired = old;
+                        TOp()(&desired, value);
+                        // Min, Max, And and Or often leave the value unchanged which does not require a write.
+                        if(std::memcmp(&desired, &old, sizeof(T)) == 0)
+                        {
+                            break;
+                        }
+                    }
+                    while(!__atomic_compare_exchange(addr, &old, &desired, true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+                    return old;
+                }
+            };
+            //#############################################################################
+            template<
+                typename T>
+            struct AtomicOpLockFree<
+                op::Add,
+                T,
+                std::enable_if_t<std::is_integral<T>::value>>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto atomicOp(
+                    T * const addr,
+                    T const & value)
+                -> T
+                {
+                    return __atomic_fetch_add(addr, value, __ATOMIC_ACQ_REL);
+                }
+            };
+            //#############################################################################
+            template<
+                typename T>
+            struct AtomicOpLockFree<
+                op::Sub,
+                T,
+                std::enable_if_t<std::is_integral<T>::value>>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto atomicOp(
+                    T * const addr,
+                    T const & value)
+                -> T
+                {
+                    return __atomic_fetch_sub(addr, value, __ATOMIC_ACQ_REL);
+                }
+            };
+            //#############################################################################
+            template<
+                typename T>
+            struct AtomicOpLockFree<
+                op::Exch,
+                T>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto atomicOp(
+                    T * const addr,
+                    T const & value)
+                -> T
+                {
+                    T old;
+                    __atomic_exchange(addr, &value, &old, __ATOMIC_ACQ_REL);
+                    return old;
+                }
+            };
+            //#############################################################################
+            template<
+                typename T>
+            struct AtomicOpLockFree<
+                op::And,
+                T>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto atomicOp(
+                    T * const addr,
+                    T const & value)
+                -> T
+                {
+                    return __atomic_fetch_and(addr, value, __ATOMIC_ACQ_REL);
+                }
+            };
+            //#############################################################################
+            template<
+                typename T>
+            struct AtomicOpLockFree<
+                op::Or,
+                T>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto atomicOp(
+                    T * const addr,
+                    T const & value)
+                -> T
+                {
+                    return __atomic_fetch_or(addr, value, __ATOMIC_ACQ_REL);
+                }
+            };
+            //#############################################################################
+            template<
+                typename T>
+            struct AtomicOpLockFree<
+                op::Xor,
+                T>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto atomicOp(
+                    T * const addr,
+                    T const & value)
+                -> T
+                {
+                    return __atomic_fetch_xor(addr, value, __ATOMIC_ACQ_REL);
+                }
+            };
+            //#############################################################################
+            template<
+                typename T>
+            struct AtomicOpLockFree<
+                op::Cas,
+                T>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto atomicOp(
+                    T * const addr,
+                    T const & compare,
+                    T const & value)
+                -> T
+                {
+                    T old;
+                    __atomic_load(addr, &old, __ATOMIC_ACQUIRE);
+                    // The values are compared like op::Cas does and not bitwise like the builtin so that e.g. 0.0 matches -0.0.
+                    // If the swap fails, old is updated and compared again.
+                    while(old == compare)
+                    {
+                        T desired(value);
+                        if(__atomic_compare_exchange(addr, &old, &desired, true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+                        {
+                            break;
+                        }
+                    }
+                    return old;
+                }
+            };
+#endif
+        }
+    }
+}
@@ -11,9 +11,14 @@
 
 #ifdef _OPENMP
 
+#include <alpaka/atomic/AtomicLockFree.hpp>
 #include <alpaka/atomic/Traits.hpp>
 #include <alpaka/atomic/Op.hpp>
 
+#include <alpaka/core/Unused.hpp>
+
+#include <type_traits>
+
 namespace alpaka
 {
     namespace atomic
@@ -233,6 +238,9 @@ namespace alpaka
             //! The OpenMP accelerators atomic operation
             //
             // generic implementations for operations where native atomics are not available
+            //
+            // Values with a lock-free size are updated with a compare-and-swap loop.
+            // All other values are protected by a critical section.
             template<
                 typename TOp,
                 typename T,
@@ -245,11 +253,59 @@ namespace alpaka
             {
                 //-----------------------------------------------------------------------------
                 ALPAKA_FN_HOST static auto atomicOp(
-                    atomic::AtomicOmpBuiltIn const &,
+                    atomic::AtomicOmpBuiltIn const & atomic,
+                    T * const addr,
+                    T const & value)
+                -> T
+                {
+                    return atomicOp(atomic, addr, value, detail::IsAtomicLockFree<T>());
+                }
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto atomicOp(
+                    atomic::AtomicOmpBuiltIn const & atomic,
                     T * const addr,
+                    T const & compare,
                     T const & value)
                 -> T
                 {
+                    return atomicOp(atomic, addr, compare, value, detail::IsAtomicLockFree<T>());
+                }
+
+            private:
+#if BOOST_COMP_GNUC || BOOST_COMP_CLANG
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto atomicOp(
+                    atomic::AtomicOmpBuiltIn const & atomic,
+                    T * const addr,
+                    T const & value,
+                    std::true_type)
+                -> T
+                {
+                    alpaka::ignore_unused(atomic);
+                    return detail::AtomicOpLockFree<TOp, T>::atomicOp(addr, value);
+                }
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto atomicOp(
+                    atomic::AtomicOmpBuiltIn const & atomic,
+                    T * const addr,
+                    T const & compare,
+                    T const & value,
+                    std::true_type)
+                -> T
+                {
+                    alpaka::ignore_unused(atomic);
+                    return detail::AtomicOpLockFree<TOp, T>::atomicOp(addr, compare, value);
+                }
+#endif
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto atomicOp(
+                    atomic::AtomicOmpBuiltIn const & atomic,
+                    T * const addr,
+                    T const & value,
+                    std::false_type)
+                -> T
+                {
+                    alpaka::ignore_unused(atomic);
                     T old;
                     // \TODO: Currently not only the access to the same memory location is protected by a mutex but all atomic ops on all threads.
                     #pragma omp critical (AlpakaOmpAtomicOp)
@@ -260,12 +316,14 @@ namespace alpaka
                 }
                 //-----------------------------------------------------------------------------
                 ALPAKA_FN_HOST static auto atomicOp(
-                    atomic::AtomicOmpBuiltIn const &,
+                    atomic::AtomicOmpBuiltIn const & atomic,
                     T * const addr,
                     T const & compare,
-                    T const & value)
+                    T const & value,
+                    std::false_type)
                 -> T
                 {
+                    alpaka::ignore_unused(atomic);
                     T old;
                     // \TODO: Currently not only the access to the same memory location is protected by a mutex but all atomic ops on all threads.
                     #pragma omp critical (AlpakaOmpAtomicOp2)
@@ -9,12 +9,15 @@
 
 #pragma once
 
+#include <alpaka/atomic/AtomicLockFree.hpp>
 #include <alpaka/atomic/Traits.hpp>
 
 #include <alpaka/core/BoostPredef.hpp>
+#include <alpaka/core/Unused.hpp>
 
 #include <mutex>
 #include <array>
+#include <type_traits>
 
 namespace alpaka
 {
@@ -26,6 +29,9 @@ namespace alpaka
         //  Atomics can be used in the grids, blocks and threads hierarchy levels.
         //  Atomics are not guaranteed to be save between devices.
         //
+        //  Integral and floating point values with a lock-free size are updated in place with the atomic builtins of the compiler.
+        //  Only all other types are protected by a mutex selected by hashing their address.
+        //
         // \tparam THashTableSize size of the hash table to allow concurrency between
         //                        atomics to different addresses
         template<size_t THashTableSize>
@@ -119,6 +125,53 @@ namespace alpaka
                     T * const addr,
                     T const & value)
                 -> T
+                {
+                    return atomicOp(atomic, addr, value, detail::IsAtomicLockFree<T>());
+                }
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto atomicOp(
+                    atomic::AtomicStdLibLock<THashTableSize> const & atomic,
+                    T * const addr,
+                    T const & compare,
+                    T const & value)
+                -> T
+                {
+                    return atomicOp(atomic, addr, compare, value, detail::IsAtomicLockFree<T>());
+                }
+
+            private:
+#if BOOST_COMP_GNUC || BOOST_COMP_CLANG
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto atomicOp(
+                    atomic::AtomicStdLibLock<THashTableSize> const & atomic,
+                    T * const addr,
+                    T const & value,
+                    std::true_type)
+                -> T
+                {
+                    alpaka::ignore_unused(atomic);
+                    return detail::AtomicOpLockFree<TOp, T>::atomicOp(addr, value);
+                }
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto atomicOp(
+                    atomic::AtomicStdLibLock<THashTableSize> const & atomic,
+                    T * const addr,
+                    T const & compare,
+                    T const & value,
+                    std::true_type)
+                -> T
+                {
+                    alpaka::ignore_unused(atomic);
+                    return detail::AtomicOpLockFree<TOp, T>::atomicOp(addr, compare, value);
+                }
+#endif
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto atomicOp(
+                    atomic::AtomicStdLibLock<THashTableSize> const & atomic,
+                    T * const addr,
+                    T const & value,
+                    std::false_type)
+                -> T
                 {
                     std::lock_guard<std::mutex> lock(atomic.getMutex(addr));
                     return TOp()(addr, value);
@@ -128,7 +181,8 @@ namespace alpaka
                     atomic::AtomicStdLibLock<THashTableSize> const & atomic,
                     T * const addr,
                     T const & compare,
-                    T const & value)
+                    T const & value,
+                    std::false_type)
                 -> T
                 {
                     std::lock_guard<std::mutex> lock(atomic.getMutex(addr));
@@ -11,13 +11,24 @@
 
 #include <alpaka/core/Vectorize.hpp>
 #include <alpaka/block/shared/st/Traits.hpp>
+#include <alpaka/block/sync/Traits.hpp>
 
 #include <alpaka/core/AlignedAlloc.hpp>
 #include <alpaka/core/Common.hpp>
 
-#include <vector>
-#include <memory>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+//! The number of bytes of the first chunk of static block shared memory allocated by the master thread synchronized allocator.
+#ifndef ALPAKA_BLOCK_SHARED_ST_ARENA_INITIAL_CAPACITY
+    #define ALPAKA_BLOCK_SHARED_ST_ARENA_INITIAL_CAPACITY 1024
+#endif
 
 namespace alpaka
 {
@@ -27,17 +38,144 @@ namespace alpaka
         {
             namespace st
             {
+                namespace detail
+                {
+                    //#############################################################################
+                    //! A growable bump allocator for the static block shared memory of a single block.
+                    //!
+                    //! The memory is kept across blocks so that after the first block an allocation only increments an offset.
+                    //! If a block requires more memory than available, an additional chunk is allocated which keeps all previously returned variables valid.
+                    //! The chunks are merged into a single chunk when the block is finished.
+                    class BlockSharedMemStArena
+                    {
+                    public:
+                        //-----------------------------------------------------------------------------
+                        BlockSharedMemStArena() = default;
+                        //-----------------------------------------------------------------------------
+                        BlockSharedMemStArena(BlockSharedMemStArena const &) = delete;
+                        //-----------------------------------------------------------------------------
+                        BlockSharedMemStArena(BlockSharedMemStArena &&) = delete;
+                        //-----------------------------------------------------------------------------
+                        auto operator=(BlockSharedMemStArena const &) -> BlockSharedMemStArena & = delete;
+                        //-----------------------------------------------------------------------------
+                        auto operator=(BlockSharedMemStArena &&) -> BlockSharedMemStArena & = delete;
+                        //-----------------------------------------------------------------------------
+                        /*virtual*/ ~BlockSharedMemStArena() = default;
+
+                        //-----------------------------------------------------------------------------
+                        //! \return A pointer to sizeInBytes bytes of uninitialized memory aligned to alignmentInBytes.
+                        ALPAKA_FN_HOST auto alloc(
+                            std::size_t const & sizeInBytes,
+                            std::size_t const & alignmentInBytes)
+                        -> std::uint8_t *
+                        {
+                            if(!m_chunks.empty())
+                            {
+                                auto & chunk(m_chunks.back());
+                                auto const offset(alignOffset(chunk.m_mem.get(), m_chunkBytesUsed, alignmentInBytes));
+                                if(offset + sizeInBytes <= chunk.m_capacity)
+                                {
+                                    m_chunkBytesUsed = offset + sizeInBytes;
+                                    return chunk.m_mem.get() + offset;
+                                }
+                            }
+
+                            // The current chunk is exhausted. The capacity grows geometrically to bound the number of chunks per block.
+                            auto const capacity(
+                                std::max(
+                                    std::max(getCapacity(), static_cast<std::size_t>(ALPAKA_BLOCK_SHARED_ST_ARENA_INITIAL_CAPACITY)),
+                                    sizeInBytes + alignmentInBytes));
+                            addChunk(capacity);
+                            auto const offset(alignOffset(m_chunks.back().m_mem.get(), 0u, alignmentInBytes));
+                            m_chunkBytesUsed = offset + sizeInBytes;
+                            return m_chunks.back().m_mem.get() + offset;
+                        }
+                        //-----------------------------------------------------------------------------
+                        //! Invalidates all allocations and merges the chunks so that the next block fits into a single one.
+                        ALPAKA_FN_HOST auto reset()
+                        -> void
+                        {
+                            if(m_chunks.size() > 1u)
+                            {
+                                auto const capacity(getCapacity());
+                                m_chunks.clear();
+                                addChunk(capacity);
+                            }
+                            m_chunkBytesUsed = 0u;
+                        }
+
+                    private:
+                        //#############################################################################
+                        struct Chunk
+                        {
+                            std::unique_ptr<std::uint8_t, core::AlignedDelete> m_mem;
+                            std::size_t m_capacity;
+                        };
+
+                        //-----------------------------------------------------------------------------
+                        //! \return The offset of the first address after the given offset with the given alignment.
+                        ALPAKA_FN_HOST static auto alignOffset(
+                            std::uint8_t const * const mem,
+                            std::size_t const & offset,
+                            std::size_t const & alignmentInBytes)
+                        -> std::size_t
+                        {
+                            auto const address(reinterpret_cast<std::uintptr_t>(mem) + offset);
+                            return offset + (alignmentInBytes - address % alignmentInBytes) % alignmentInBytes;
+                        }
+                        //-----------------------------------------------------------------------------
+                        //! \return The sum of the capacities of all chunks.
+                        ALPAKA_FN_HOST auto getCapacity() const
+                        -> std::size_t
+                        {
+                            std::size_t capacity(0u);
+                            for(auto const & chunk : m_chunks)
+                            {
+                                capacity += chunk.m_capacity;
+                            }
+                            return capacity;
+                        }
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST auto addChunk(
+                            std::size_t const & capacity)
+                        -> void
+                        {
+                            m_chunks.push_back(
+                                Chunk{
+                                    std::unique_ptr<std::uint8_t, core::AlignedDelete>(
+                                        reinterpret_cast<std::uint8_t *>(
+                                            core::alignedAlloc(core::vectorization::defaultAlignment, capacity))),
+                                    capacity});
+                        }
+
+                    private:
+                        std::vector<Chunk> m_chunks;
+                        std::size_t m_chunkBytesUsed = 0u;  //!< The number of bytes used in the last chunk.
+                    };
+                }
+
                 //#############################################################################
                 //! The block shared memory allocator allocating memory with synchronization on the master thread.
-                class BlockSharedMemStMasterSync : public concepts::Implements<ConceptBlockSharedSt, BlockSharedMemStMasterSync>
+                //!
+                //! \tparam TBlockSync The block synchronization implementation of the accelerator.
+                //! \tparam TIdxBt The block thread index provider of the accelerator. It has to provide isMasterThread().
+                //! \tparam TPublishAtomically If the master thread publishes the allocation through an atomic instead of a second block synchronization.
+                //! The other threads busy wait for the allocation so this requires the threads of a block to be preemptively scheduled.
+                template<
+                    typename TBlockSync,
+                    typename TIdxBt,
+                    bool TPublishAtomically = true>
+                class BlockSharedMemStMasterSync : public concepts::Implements<ConceptBlockSharedSt, BlockSharedMemStMasterSync<TBlockSync, TIdxBt, TPublishAtomically>>
                 {
                 public:
                     //-----------------------------------------------------------------------------
+                    //! \param blockSync The block synchronization. It is only used after construction so it may be a base class of the accelerator which is not yet constructed.
+                    //! \param idxBt The block thread index provider. It is only used after construction so it may be a base class of the accelerator which is not yet constructed.
                     BlockSharedMemStMasterSync(
-                        std::function<void()> fnSync,
-                        std::function<bool()> fnIsMasterThread) :
-                            m_syncFn(fnSync),
-                            m_isMasterThreadFn(fnIsMasterThread)
+                        TBlockSync const & blockSync,
+                        TIdxBt const & idxBt) :
+                            m_blockSync(blockSync),
+                            m_idxBt(idxBt)
                     {}
                     //-----------------------------------------------------------------------------
                     BlockSharedMemStMasterSync(BlockSharedMemStMasterSync const &) = delete;
@@ -53,14 +191,14 @@ namespace alpaka
                 public:
                     // TODO: We should add the size of the (current) allocation.
                     // This would allow to assert that all parallel function calls request to allocate the same size.
-                    std::vector<
-                        std::unique_ptr<
-                            uint8_t,
-                            core::AlignedDelete>> mutable
-                        m_sharedAllocs;
-
-                    std::function<void()> m_syncFn;
-                    std::function<bool()> m_isMasterThreadFn;
+                    detail::BlockSharedMemStArena mutable m_sharedArena;
+                    //! The variable allocated last by the master thread.
+                    std::uint8_t mutable * m_latestSharedAlloc = nullptr;
+                    //! The number of variables allocated by the master thread. Only used if TPublishAtomically is true.
+                    std::atomic<std::size_t> mutable m_sharedAllocCount{0u};
+
+                    TBlockSync const & m_blockSync;
+                    TIdxBt const & m_idxBt;
                 };
 
                 namespace traits
@@ -72,50 +210,77 @@ namespace alpaka
                     //#############################################################################
                     template<
                         typename T,
-                        std::size_t TuniqueId>
+                        std::size_t TuniqueId,
+                        typename TBlockSync,
+                        typename TIdxBt,
+                        bool TPublishAtomically>
                     struct AllocVar<
                         T,
                         TuniqueId,
-                        BlockSharedMemStMasterSync>
+                        BlockSharedMemStMasterSync<TBlockSync, TIdxBt, TPublishAtomically>>
                     {
                         //-----------------------------------------------------------------------------
                         ALPAKA_FN_HOST static auto allocVar(
-                            block::shared::st::BlockSharedMemStMasterSync const & blockSharedMemSt)
+                            block::shared::st::BlockSharedMemStMasterSync<TBlockSync, TIdxBt, TPublishAtomically> const & blockSharedMemSt)
                         -> T &
                         {
                             constexpr std::size_t alignmentInBytes = std::max(core::vectorization::defaultAlignment, alignof(T));
 
+                            // The master thread can not publish the next allocation before all threads have passed the following synchronization.
+                            // Therefore the count read here belongs to the previous allocation.
+                            auto const sharedAllocCount(
+                                TPublishAtomically
+                                ? blockSharedMemSt.m_sharedAllocCount.load(std::memory_order_relaxed)
+                                : static_cast<std::size_t>(0u));
+
                             // Assure that all threads have executed the return of the last allocBlockSharedArr function (if there was one before).
-                            blockSharedMemSt.m_syncFn();
+                            block::sync::syncBlockThreads(blockSharedMemSt.m_blockSync);
 
-                            if(blockSharedMemSt.m_isMasterThreadFn())
+                            if(blockSharedMemSt.m_idxBt.isMasterThread())
                             {
-                                blockSharedMemSt.m_sharedAllocs.emplace_back(
-                                    reinterpret_cast<uint8_t *>(
-                                        core::alignedAlloc(alignmentInBytes, sizeof(T))));
+                                blockSharedMemSt.m_latestSharedAlloc = blockSharedMemSt.m_sharedArena.alloc(sizeof(T), alignmentInBytes);
+                                if(TPublishAtomically)
+                                {
+                                    blockSharedMemSt.m_sharedAllocCount.store(sharedAllocCount + 1u, std::memory_order_release);
+                                }
+                            }
+
+                            if(TPublishAtomically)
+                            {
+                                // Allocating from the arena is short so waiting for it is cheaper than a second block synchronization.
+                                while(blockSharedMemSt.m_sharedAllocCount.load(std::memory_order_acquire) == sharedAllocCount)
+                                {
+                                    std::this_thread::yield();
+                                }
+                            }
+                            else
+                            {
+                                block::sync::syncBlockThreads(blockSharedMemSt.m_blockSync);
                             }
-                            blockSharedMemSt.m_syncFn();
 
                             return
                                 std::ref(
                                     *reinterpret_cast<T*>(
-                                        blockSharedMemSt.m_sharedAllocs.back().get()));
+                                        blockSharedMemSt.m_latestSharedAlloc));
                         }
                     };
 #if BOOST_COMP_GNUC
     #pragma GCC diagnostic pop
 #endif
                     //#############################################################################
-                    template<>
+                    template<
+                        typename TBlockSync,
+                        typename TIdxBt,
+                        bool TPublishAtomically>
                     struct FreeMem<
-                        BlockSharedMemStMasterSync>
+                        BlockSharedMemStMasterSync<TBlockSync, TIdxBt, TPublishAtomically>>
                     {
                         //-----------------------------------------------------------------------------
                         ALPAKA_FN_HOST static auto freeMem(
-                            block::shared::st::BlockSharedMemStMasterSync const & blockSharedMemSt)
+                            block::shared::st::BlockSharedMemStMasterSync<TBlockSync, TIdxBt, TPublishAtomically> const & blockSharedMemSt)
                         -> void
                         {
-                            blockSharedMemSt.m_sharedAllocs.clear();
+                            blockSharedMemSt.m_sharedArena.reset();
                         }
                     };
                 }
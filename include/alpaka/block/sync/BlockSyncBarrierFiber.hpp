@@ -34,12 +34,16 @@ namespace alpaka
             {
             public:
                 //-----------------------------------------------------------------------------
+                //! \param activeFiberIdx The linear block thread index of the running fiber. It is owned by the accelerator.
                 ALPAKA_FN_HOST BlockSyncBarrierFiber(
-                    TIdx const & blockThreadCount) :
+                    TIdx const & blockThreadCount,
+                    TIdx & activeFiberIdx) :
                         m_barrier(static_cast<std::size_t>(blockThreadCount)),
                         m_threadCount(blockThreadCount),
                         m_curThreadCount(static_cast<TIdx>(0u)),
-                        m_generation(static_cast<TIdx>(0u))
+                        m_trueCount(static_cast<TIdx>(0u)),
+                        m_generation(static_cast<TIdx>(0u)),
+                        m_activeFiberIdx(activeFiberIdx)
                 {}
                 //-----------------------------------------------------------------------------
                 ALPAKA_FN_HOST BlockSyncBarrierFiber(BlockSyncBarrierFiber const &) = delete;
@@ -56,8 +60,13 @@ namespace alpaka
 
                 TIdx mutable m_threadCount;
                 TIdx mutable m_curThreadCount;
+                TIdx mutable m_trueCount;
                 TIdx mutable m_generation;
                 int mutable m_result[2u];
+
+                //! The linear index of the block thread executed by the running fiber.
+                //! The fibers of a block only switch while waiting at the barrier, so each fiber restores its own index afterwards.
+                TIdx & m_activeFiberIdx;
             };
 
             namespace traits
@@ -73,7 +82,9 @@ namespace alpaka
                         block::sync::BlockSyncBarrierFiber<TIdx> const & blockSync)
                     -> void
                     {
+                        auto const activeFiberIdx(blockSync.m_activeFiberIdx);
                         blockSync.m_barrier.wait();
+                        blockSync.m_activeFiberIdx = activeFiberIdx;
                     }
                 };
 
@@ -92,27 +103,30 @@ namespace alpaka
                         int predicate)
                     -> int
                     {
-                        if(blockSync.m_curThreadCount == blockSync.m_threadCount)
-                        {
-                            blockSync.m_curThreadCount = static_cast<TIdx>(0u);
-                            ++blockSync.m_generation;
-                        }
-
                         auto const generationMod2(blockSync.m_generation % static_cast<TIdx>(2u));
 
-                        // The first fiber will reset the value to the initial value.
-                        if(blockSync.m_curThreadCount == static_cast<TIdx>(0u))
+                        // We do not have to lock because there is only ever one fiber active per block.
+                        if(predicate != 0)
                         {
-                            blockSync.m_result[generationMod2] = TOp::InitialValue;
+                            ++blockSync.m_trueCount;
                         }
 
-                        ++blockSync.m_curThreadCount;
-
-                        // We do not have to lock because there is only ever one fiber active per block.
-                        blockSync.m_result[generationMod2] = TOp()(blockSync.m_result[generationMod2], predicate);
+                        // The last fiber arriving computes the result and resets the counters for the next generation.
+                        if(++blockSync.m_curThreadCount == blockSync.m_threadCount)
+                        {
+                            blockSync.m_result[generationMod2] =
+                                block::sync::detail::ReducePredicateCount<TOp>::reduce(
+                                    blockSync.m_trueCount,
+                                    blockSync.m_threadCount);
+                            blockSync.m_curThreadCount = static_cast<TIdx>(0u);
+                            blockSync.m_trueCount = static_cast<TIdx>(0u);
+                            ++blockSync.m_generation;
+                        }
 
                         // After all block threads have combined their values ...
+                        auto const activeFiberIdx(blockSync.m_activeFiberIdx);
                         blockSync.m_barrier.wait();
+                        blockSync.m_activeFiberIdx = activeFiberIdx;
 
                         // ... the result can be returned.
                         return blockSync.m_result[generationMod2];
@@ -0,0 +1,145 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#ifdef ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLED
+
+#include <alpaka/block/sync/Traits.hpp>
+
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/LaneScheduler.hpp>
+
+namespace alpaka
+{
+    namespace block
+    {
+        namespace sync
+        {
+            //#############################################################################
+            //! The lane scheduler block synchronization.
+            //!
+            //! Only one block thread runs at a time and switches only happen at synchronization points, so the counters do not require any locking.
+            //! A waiting block thread yields to the next one until the last arriving block thread has started the next generation.
+            template<
+                typename TIdx>
+            class BlockSyncBarrierLane : public concepts::Implements<ConceptBlockSync, BlockSyncBarrierLane<TIdx>>
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                //! \param laneScheduler The scheduler executing the block threads. It is owned by the accelerator.
+                ALPAKA_FN_HOST BlockSyncBarrierLane(
+                    TIdx const & blockThreadCount,
+                    core::detail::LaneScheduler<TIdx> const & laneScheduler) :
+                        m_threadCount(blockThreadCount),
+                        m_curThreadCount(static_cast<TIdx>(0u)),
+                        m_trueCount(static_cast<TIdx>(0u)),
+                        m_generation(static_cast<TIdx>(0u)),
+                        m_result(0),
+                        m_laneScheduler(laneScheduler)
+                {}
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST BlockSyncBarrierLane(BlockSyncBarrierLane const &) = delete;
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST BlockSyncBarrierLane(BlockSyncBarrierLane &&) = delete;
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator=(BlockSyncBarrierLane const &) -> BlockSyncBarrierLane & = delete;
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator=(BlockSyncBarrierLane &&) -> BlockSyncBarrierLane & = delete;
+                //-----------------------------------------------------------------------------
+                /*virtual*/ ~BlockSyncBarrierLane() = default;
+
+                //-----------------------------------------------------------------------------
+                //! Waits until all block threads have arrived.
+                //! \return If the calling block thread was the last one to arrive.
+                ALPAKA_FN_HOST auto wait() const
+                -> bool
+                {
+                    auto const generation(m_generation);
+                    if(++m_curThreadCount == m_threadCount)
+                    {
+                        m_curThreadCount = static_cast<TIdx>(0u);
+                        ++m_generation;
+                        return true;
+                    }
+                    while(m_generation == generation)
+                    {
+                        m_laneScheduler.yield();
+                    }
+                    return false;
+                }
+
+                TIdx m_threadCount;
+                TIdx mutable m_curThreadCount;
+                TIdx mutable m_trueCount;
+                TIdx mutable m_generation;
+                //! The result of the last predicate synchronization.
+                //! The next one can not overwrite it before all block threads have arrived there, so a single slot suffices.
+                int mutable m_result;
+
+                core::detail::LaneScheduler<TIdx> const & m_laneScheduler;
+            };
+
+            namespace traits
+            {
+                //#############################################################################
+                template<
+                    typename TIdx>
+                struct SyncBlockThreads<
+                    BlockSyncBarrierLane<TIdx>>
+                {
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST static auto syncBlockThreads(
+                        block::sync::BlockSyncBarrierLane<TIdx> const & blockSync)
+                    -> void
+                    {
+                        blockSync.wait();
+                    }
+                };
+
+                //#############################################################################
+                template<
+                    typename TOp,
+                    typename TIdx>
+                struct SyncBlockThreadsPredicate<
+                    TOp,
+                    BlockSyncBarrierLane<TIdx>>
+                {
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_NO_HOST_ACC_WARNING
+                    ALPAKA_FN_ACC static auto syncBlockThreadsPredicate(
+                        block::sync::BlockSyncBarrierLane<TIdx> const & blockSync,
+                        int predicate)
+                    -> int
+                    {
+                        if(predicate != 0)
+                        {
+                            ++blockSync.m_trueCount;
+                        }
+
+                        // The last block thread arriving computes the result before the others are resumed.
+                        if(blockSync.m_curThreadCount + static_cast<TIdx>(1u) == blockSync.m_threadCount)
+                        {
+                            blockSync.m_result =
+                                block::sync::detail::ReducePredicateCount<TOp>::reduce(
+                                    blockSync.m_trueCount,
+                                    blockSync.m_threadCount);
+                            blockSync.m_trueCount = static_cast<TIdx>(0u);
+                        }
+                        blockSync.wait();
+
+                        return blockSync.m_result;
+                    }
+                };
+            }
+        }
+    }
+}
+
+#endif
@@ -16,6 +16,11 @@
 #include <alpaka/core/Common.hpp>
 #include <alpaka/core/Unused.hpp>
 
+#include <omp.h>
+
+#include <atomic>
+#include <cstdint>
+
 namespace alpaka
 {
     namespace block
@@ -29,6 +34,7 @@ namespace alpaka
             public:
                 //-----------------------------------------------------------------------------
                 ALPAKA_FN_HOST BlockSyncBarrierOmp() :
+                    m_arrivals(0u),
                     m_generation(0u)
                 {}
                 //-----------------------------------------------------------------------------
@@ -42,7 +48,9 @@ namespace alpaka
                 //-----------------------------------------------------------------------------
                 /*virtual*/ ~BlockSyncBarrierOmp() = default;
 
-                std::uint8_t mutable m_generation;
+                //! The number of arrived threads in the lower and the number of true predicates in the upper 32 bits.
+                std::atomic<std::uint64_t> mutable m_arrivals;
+                std::atomic<std::uint32_t> mutable m_generation;
                 int mutable m_result[2];
             };
 
@@ -66,47 +74,6 @@ namespace alpaka
                     }
                 };
 
-                namespace detail
-                {
-                    //#############################################################################
-                    template<
-                        typename TOp>
-                    struct AtomicOp;
-                    //#############################################################################
-                    template<>
-                    struct AtomicOp<
-                        block::sync::op::Count>
-                    {
-                        void operator()(int& result, bool value)
-                        {
-                            #pragma omp atomic
-                            result += static_cast<int>(value);
-                        }
-                    };
-                    //#############################################################################
-                    template<>
-                    struct AtomicOp<
-                        block::sync::op::LogicalAnd>
-                    {
-                        void operator()(int& result, bool value)
-                        {
-                            #pragma omp atomic
-                            result &= static_cast<int>(value);
-                        }
-                    };
-                    //#############################################################################
-                    template<>
-                    struct AtomicOp<
-                        block::sync::op::LogicalOr>
-                    {
-                        void operator()(int& result, bool value)
-                        {
-                            #pragma omp atomic
-                            result |= static_cast<int>(value);
-                        }
-                    };
-                }
-
                 //#############################################################################
                 template<
                     typename TOp>
@@ -121,24 +88,25 @@ namespace alpaka
                         int predicate)
                     -> int
                     {
-                        // The first thread initializes the value.
-                        // There is an implicit barrier at the end of omp single.
-                        // NOTE: This code is executed only once for all OpenMP threads.
-                        // If multiple blocks with multiple threads are executed in parallel
-                        // this reduction is executed only for one block!
-                        #pragma omp single
+                        // The reduction is part of the arrival: Each thread adds itself and its predicate to a single packed counter.
+                        // The last arriving thread publishes the result before the only barrier.
+                        // The generation can not change before this thread has arrived.
+                        auto const generationMod2(blockSync.m_generation.load(std::memory_order_relaxed) % 2u);
+                        auto const trueCountShift(32u);
+                        auto const arrival(static_cast<std::uint64_t>(1u) + (static_cast<std::uint64_t>(predicate != 0) << trueCountShift));
+                        auto const arrivals(blockSync.m_arrivals.fetch_add(arrival, std::memory_order_acq_rel) + arrival);
+                        auto const threadCount(static_cast<std::uint64_t>(::omp_get_num_threads()));
+                        if((arrivals & ((static_cast<std::uint64_t>(1u) << trueCountShift) - 1u)) == threadCount)
                         {
-                            ++blockSync.m_generation;
-                            blockSync.m_result[blockSync.m_generation % 2u] = TOp::InitialValue;
+                            // The result of the previous generation in this slot has been read by all threads because they arrived at the generation in between.
+                            blockSync.m_result[generationMod2] =
+                                block::sync::detail::ReducePredicateCount<TOp>::reduce(
+                                    arrivals >> trueCountShift,
+                                    threadCount);
+                            blockSync.m_arrivals.store(0u, std::memory_order_relaxed);
+                            blockSync.m_generation.fetch_add(1u, std::memory_order_relaxed);
                         }
 
-                        auto const generationMod2(blockSync.m_generation % 2u);
-                        int& result(blockSync.m_result[generationMod2]);
-                        bool const predicateBool(predicate != 0);
-
-                        detail::AtomicOp<TOp>()(result, predicateBool);
-
-                        // Wait for all threads to write their predicate into the vector.
                         // NOTE: This waits for all threads in all blocks.
                         // If multiple blocks are executed in parallel this is not optimal.
                         #pragma omp barrier
@@ -34,7 +34,11 @@ namespace alpaka
             class BlockSyncBarrierThread : public concepts::Implements<ConceptBlockSync, BlockSyncBarrierThread<TIdx>>
             {
             public:
+#ifdef ALPAKA_THREAD_BARRIER_TREE
+                using Barrier = core::threads::BarrierThreadTree<TIdx>;
+#else
                 using Barrier = core::threads::BarrierThread<TIdx>;
+#endif
                 using BarrierWithPredicate = core::threads::BarrierThreadWithPredicate<TIdx>;
 
                 //-----------------------------------------------------------------------------
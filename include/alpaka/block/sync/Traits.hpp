@@ -11,6 +11,7 @@
 
 #include <alpaka/core/Common.hpp>
 #include <alpaka/core/Concepts.hpp>
+#include <alpaka/core/Unused.hpp>
 
 #include <type_traits>
 
@@ -122,6 +123,66 @@ namespace alpaka
                 };
             }
 
+            namespace detail
+            {
+                //#############################################################################
+                //! Computes the result of a predicate reduction from the number of threads with a non-zero predicate.
+                //! This allows the barriers to count the predicates while the threads arrive independent of the operation.
+                template<
+                    typename TOp>
+                struct ReducePredicateCount;
+                //#############################################################################
+                template<>
+                struct ReducePredicateCount<
+                    op::Count>
+                {
+                    //-----------------------------------------------------------------------------
+                    template<
+                        typename TIdx>
+                    ALPAKA_FN_HOST static auto reduce(
+                        TIdx const & trueCount,
+                        TIdx const & threadCount)
+                    -> int
+                    {
+                        alpaka::ignore_unused(threadCount);
+                        return static_cast<int>(trueCount);
+                    }
+                };
+                //#############################################################################
+                template<>
+                struct ReducePredicateCount<
+                    op::LogicalAnd>
+                {
+                    //-----------------------------------------------------------------------------
+                    template<
+                        typename TIdx>
+                    ALPAKA_FN_HOST static auto reduce(
+                        TIdx const & trueCount,
+                        TIdx const & threadCount)
+                    -> int
+                    {
+                        return static_cast<int>(trueCount == threadCount);
+                    }
+                };
+                //#############################################################################
+                template<>
+                struct ReducePredicateCount<
+                    op::LogicalOr>
+                {
+                    //-----------------------------------------------------------------------------
+                    template<
+                        typename TIdx>
+                    ALPAKA_FN_HOST static auto reduce(
+                        TIdx const & trueCount,
+                        TIdx const & threadCount)
+                    -> int
+                    {
+                        alpaka::ignore_unused(threadCount);
+                        return static_cast<int>(trueCount != static_cast<TIdx>(0u));
+                    }
+                };
+            }
+
             //-----------------------------------------------------------------------------
             //! Synchronizes all threads within the current block (independently for all blocks),
             //! evaluates the predicate for all threads and returns the combination of all the results
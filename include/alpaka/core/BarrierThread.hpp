@@ -9,17 +9,61 @@
 
 #pragma once
 
-// Uncomment this to disable the standard spinlock behaviour of the threads
+// Uncomment this to disable the spinning of the threads waiting at a barrier. They are parked immediately instead.
 //#define ALPAKA_THREAD_BARRIER_DISABLE_SPINLOCK
 
+// Uncomment this to synchronize the threads of a block with the combining tree barrier instead of the central counter barrier.
+// This reduces the contention on the arrival counter for large blocks.
+//#define ALPAKA_THREAD_BARRIER_TREE
+
+//! The number of exponential backoff rounds a thread spins at a barrier before it is parked.
+#ifndef ALPAKA_THREAD_BARRIER_SPIN_COUNT
+    #ifdef ALPAKA_THREAD_BARRIER_DISABLE_SPINLOCK
+        #define ALPAKA_THREAD_BARRIER_SPIN_COUNT 0
+    #else
+        #define ALPAKA_THREAD_BARRIER_SPIN_COUNT 16
+    #endif
+#endif
+
+//! The number of times a thread yields its processor at a barrier after spinning and before it is parked.
+//! Yielding hands over the processor to the threads not yet arrived if the threads are oversubscribed.
+#ifndef ALPAKA_THREAD_BARRIER_YIELD_COUNT
+    #define ALPAKA_THREAD_BARRIER_YIELD_COUNT 8
+#endif
+
+//! The size of a cache line in bytes. The nodes of the tree barrier are aligned to it.
+#ifndef ALPAKA_THREAD_BARRIER_CACHE_LINE_SIZE
+    #define ALPAKA_THREAD_BARRIER_CACHE_LINE_SIZE 64
+#endif
+
+//! The number of threads or subtrees combined by each node of the tree barrier.
+#ifndef ALPAKA_THREAD_BARRIER_TREE_FAN_IN
+    #define ALPAKA_THREAD_BARRIER_TREE_FAN_IN 4
+#endif
+
+#include <alpaka/core/AlignedAlloc.hpp>
+#include <alpaka/core/Assert.hpp>
+#include <alpaka/core/BoostPredef.hpp>
 #include <alpaka/core/Common.hpp>
 #include <alpaka/block/sync/Traits.hpp>
 
-#include <mutex>
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
-#ifndef ALPAKA_THREAD_BARRIER_DISABLE_SPINLOCK
-    #include <atomic>
-    #include <thread>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#if BOOST_OS_LINUX
+    #include <climits>
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+#if BOOST_ARCH_X86
+    #include <immintrin.h>
 #endif
 
 namespace alpaka
@@ -28,8 +72,144 @@ namespace alpaka
     {
         namespace threads
         {
+            namespace detail
+            {
+                //-----------------------------------------------------------------------------
+                //! Tells the processor that the calling thread is busy waiting.
+                ALPAKA_FN_INLINE ALPAKA_FN_HOST auto cpuRelax()
+                -> void
+                {
+#if BOOST_ARCH_X86
+                    _mm_pause();
+#elif BOOST_ARCH_ARM
+                    __asm__ __volatile__("yield");
+#endif
+                }
+
+                //#############################################################################
+                //! The generation counter of a barrier the waiting threads can be parked on.
+                //!
+                //! A waiting thread first spins with an exponential backoff, then yields its processor a few times and is finally parked on a futex (Linux) or a condition variable.
+                //! Waking the threads only costs a system call if at least one of them has been parked.
+                class BarrierGeneration final
+                {
+                public:
+                    //-----------------------------------------------------------------------------
+                    //! \param spinCount The number of exponential backoff rounds before a thread is parked.
+                    explicit BarrierGeneration(
+                        std::uint32_t const & spinCount) :
+                            m_generation(0u),
+                            m_parkedThreadCount(0u),
+                            m_spinCount(spinCount)
+                    {}
+                    //-----------------------------------------------------------------------------
+                    BarrierGeneration(BarrierGeneration const &) = delete;
+                    //-----------------------------------------------------------------------------
+                    BarrierGeneration(BarrierGeneration &&) = delete;
+                    //-----------------------------------------------------------------------------
+                    auto operator=(BarrierGeneration const &) -> BarrierGeneration & = delete;
+                    //-----------------------------------------------------------------------------
+                    auto operator=(BarrierGeneration &&) -> BarrierGeneration & = delete;
+                    //-----------------------------------------------------------------------------
+                    ~BarrierGeneration() = default;
+
+                    //-----------------------------------------------------------------------------
+                    //! \return The current generation.
+                    auto load() const
+                    -> std::uint32_t
+                    {
+                        return m_generation.load(std::memory_order_acquire);
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Starts the next generation and wakes up all threads waiting for the current one.
+                    auto advance()
+                    -> void
+                    {
+                        // Together with the sequentially consistent increment of the parked thread count this assures that either the parking thread sees the new generation or this thread sees the parked thread.
+                        m_generation.fetch_add(1u, std::memory_order_seq_cst);
+                        if(m_parkedThreadCount.load(std::memory_order_seq_cst) != 0u)
+                        {
+#if BOOST_OS_LINUX
+                            syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&m_generation), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#else
+                            {
+                                std::lock_guard<std::mutex> lock(m_mtxPark);
+                            }
+                            m_cvPark.notify_all();
+#endif
+                        }
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Waits until the given generation has ended.
+                    auto waitWhile(
+                        std::uint32_t const & generation)
+                    -> void
+                    {
+                        for(std::uint32_t spin(0u); spin < m_spinCount; ++spin)
+                        {
+                            if(m_generation.load(std::memory_order_acquire) != generation)
+                            {
+                                return;
+                            }
+                            for(std::uint32_t i(0u); i < (1u << std::min(spin, 6u)); ++i)
+                            {
+                                cpuRelax();
+                            }
+                        }
+                        for(std::uint32_t i(0u); i < static_cast<std::uint32_t>(ALPAKA_THREAD_BARRIER_YIELD_COUNT); ++i)
+                        {
+                            if(m_generation.load(std::memory_order_acquire) != generation)
+                            {
+                                return;
+                            }
+                            std::this_thread::yield();
+                        }
+
+                        m_parkedThreadCount.fetch_add(1u, std::memory_order_seq_cst);
+                        while(m_generation.load(std::memory_order_seq_cst) == generation)
+                        {
+#if BOOST_OS_LINUX
+                            // Returns immediately if the generation has already changed.
+                            syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&m_generation), FUTEX_WAIT_PRIVATE, generation, nullptr, nullptr, 0);
+#else
+                            std::unique_lock<std::mutex> lock(m_mtxPark);
+                            m_cvPark.wait(lock, [this, generation] { return generation != m_generation.load(std::memory_order_seq_cst); });
+#endif
+                        }
+                        m_parkedThreadCount.fetch_sub(1u, std::memory_order_relaxed);
+                    }
+
+                private:
+                    std::atomic<std::uint32_t> m_generation;
+                    std::atomic<std::uint32_t> m_parkedThreadCount;
+                    std::uint32_t const m_spinCount;
+#if !BOOST_OS_LINUX
+                    std::mutex m_mtxPark;
+                    std::condition_variable m_cvPark;
+#endif
+                };
+
+                //-----------------------------------------------------------------------------
+                //! \return The number of spin rounds for a barrier of the given size.
+                //! Spinning is useless if the threads of the barrier can not run concurrently.
+                template<
+                    typename TIdx>
+                ALPAKA_FN_HOST auto getBarrierSpinCount(
+                    TIdx const & threadCount)
+                -> std::uint32_t
+                {
+                    return
+                        (static_cast<unsigned int>(threadCount) <= std::thread::hardware_concurrency())
+                        ? static_cast<std::uint32_t>(ALPAKA_THREAD_BARRIER_SPIN_COUNT)
+                        : 0u;
+                }
+            }
+
             //#############################################################################
             //! A self-resetting barrier.
+            //!
+            //! The threads arrive at a central counter.
+            //! The waiting threads spin with a bounded backoff and are then parked.
             template<
                 typename TIdx>
             class BarrierThread final
@@ -40,7 +220,7 @@ namespace alpaka
                     TIdx const & threadCount) :
                     m_threadCount(threadCount),
                     m_curThreadCount(threadCount),
-                    m_generation(0)
+                    m_generation(detail::getBarrierSpinCount(threadCount))
                 {}
                 //-----------------------------------------------------------------------------
                 BarrierThread(BarrierThread const &) = delete;
@@ -58,86 +238,195 @@ namespace alpaka
                 auto wait()
                 -> void
                 {
-                    TIdx const generationWhenEnteredTheWait = m_generation;
-#ifdef ALPAKA_THREAD_BARRIER_DISABLE_SPINLOCK
-                    std::unique_lock<std::mutex> lock(m_mtxBarrier);
-#endif
+                    // The generation can not change before this thread has arrived.
+                    auto const generationWhenEnteredTheWait(m_generation.load());
                     if(--m_curThreadCount == 0)
                     {
                         m_curThreadCount = m_threadCount;
-                        ++m_generation;
-#ifdef ALPAKA_THREAD_BARRIER_DISABLE_SPINLOCK
-                        m_cvAllThreadsReachedBarrier.notify_all();
-#endif
+                        m_generation.advance();
                     }
                     else
                     {
-#ifdef ALPAKA_THREAD_BARRIER_DISABLE_SPINLOCK
-                        m_cvAllThreadsReachedBarrier.wait(lock, [this, generationWhenEnteredTheWait] { return generationWhenEnteredTheWait != m_generation; });
-#else
-                        while(generationWhenEnteredTheWait == m_generation)
-                        {
-                            std::this_thread::yield();
-                        }
-#endif
+                        m_generation.waitWhile(generationWhenEnteredTheWait);
                     }
                 }
 
             private:
-#ifdef ALPAKA_THREAD_BARRIER_DISABLE_SPINLOCK
-                std::mutex m_mtxBarrier;
-                std::condition_variable m_cvAllThreadsReachedBarrier;
-#endif
                 const TIdx m_threadCount;
-#ifdef ALPAKA_THREAD_BARRIER_DISABLE_SPINLOCK
-                TIdx m_curThreadCount;
-                TIdx m_generation;
-#else
                 std::atomic<TIdx> m_curThreadCount;
-                std::atomic<TIdx> m_generation;
-#endif
+                detail::BarrierGeneration m_generation;
             };
 
-            namespace detail
+            //#############################################################################
+            //! A self-resetting combining tree barrier.
+            //!
+            //! The threads arrive at the leaves of a tree with a fan-in of ALPAKA_THREAD_BARRIER_TREE_FAN_IN.
+            //! The last thread arriving at a node continues at its parent so each counter is only shared by a few threads.
+            //! The last thread arriving at the root releases all threads like BarrierThread.
+            //!
+            //! A thread is assigned to a leaf when it waits at the barrier for the first time.
+            //! Therefore the barrier has to be used by the same threadCount threads during its lifetime.
+            template<
+                typename TIdx>
+            class BarrierThreadTree final
             {
-                //#############################################################################
-                template<
-                    typename TOp>
-                struct AtomicOp;
-                //#############################################################################
-                template<>
-                struct AtomicOp<
-                    block::sync::op::Count>
+            public:
+                //-----------------------------------------------------------------------------
+                explicit BarrierThreadTree(
+                    TIdx const & threadCount) :
+                    m_threadCount(threadCount),
+                    m_registeredThreadCount(0u),
+                    m_barrierId(nextBarrierId()++),
+                    m_nodeCount(getNodeCount(static_cast<std::size_t>(threadCount))),
+                    m_pNodes(static_cast<Node *>(core::alignedAlloc(alignof(Node), m_nodeCount * sizeof(Node)))),
+                    m_generation(detail::getBarrierSpinCount(threadCount))
                 {
-                    void operator()(std::atomic<int>& result, bool value)
+                    if(m_pNodes == nullptr)
                     {
-                        result += static_cast<int>(value);
+                        throw std::bad_alloc();
                     }
-                };
-                //#############################################################################
-                template<>
-                struct AtomicOp<
-                    block::sync::op::LogicalAnd>
+
+                    // Create the tree level by level starting at the leaves.
+                    std::size_t const fanIn(ALPAKA_THREAD_BARRIER_TREE_FAN_IN);
+                    std::size_t levelBegin(0u);
+                    std::size_t levelChildCount(static_cast<std::size_t>(threadCount));
+                    do
+                    {
+                        std::size_t const levelNodeCount((levelChildCount + fanIn - 1u) / fanIn);
+                        for(std::size_t i(0u); i < levelNodeCount; ++i)
+                        {
+                            auto const childCount(static_cast<TIdx>(std::min(fanIn, levelChildCount - i * fanIn)));
+                            new(m_pNodes + levelBegin + i) Node(childCount, levelBegin + levelNodeCount + i / fanIn);
+                        }
+                        levelBegin += levelNodeCount;
+                        levelChildCount = levelNodeCount;
+                    }
+                    while(levelChildCount > 1u);
+                }
+                //-----------------------------------------------------------------------------
+                BarrierThreadTree(BarrierThreadTree const &) = delete;
+                //-----------------------------------------------------------------------------
+                BarrierThreadTree(BarrierThreadTree &&) = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(BarrierThreadTree const &) -> BarrierThreadTree & = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(BarrierThreadTree &&) -> BarrierThreadTree & = delete;
+                //-----------------------------------------------------------------------------
+                ~BarrierThreadTree()
                 {
-                    void operator()(std::atomic<int>& result, bool value)
+                    for(std::size_t nodeIdx(0u); nodeIdx < m_nodeCount; ++nodeIdx)
                     {
-                        result &= static_cast<int>(value);
+                        m_pNodes[nodeIdx].~Node();
                     }
-                };
-                //#############################################################################
-                template<>
-                struct AtomicOp<
-                    block::sync::op::LogicalOr>
+                    core::alignedFree(m_pNodes);
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Waits for all the other threads to reach the barrier.
+                auto wait()
+                -> void
                 {
-                    void operator()(std::atomic<int>& result, bool value)
+                    // The generation can not change before this thread has arrived.
+                    auto const generationWhenEnteredTheWait(m_generation.load());
+
+                    auto nodeIdx(static_cast<std::size_t>(getThreadIdx()) / static_cast<std::size_t>(ALPAKA_THREAD_BARRIER_TREE_FAN_IN));
+                    while(true)
                     {
-                        result |= static_cast<int>(value);
+                        auto & node(m_pNodes[nodeIdx]);
+                        if(--node.m_curChildCount != 0)
+                        {
+                            m_generation.waitWhile(generationWhenEnteredTheWait);
+                            return;
+                        }
+                        // The node can be reset immediately because none of its children can arrive again before the release.
+                        node.m_curChildCount = node.m_childCount;
+                        if(nodeIdx == m_nodeCount - 1u)
+                        {
+                            m_generation.advance();
+                            return;
+                        }
+                        nodeIdx = node.m_parent;
                     }
+                }
+
+            private:
+                //#############################################################################
+                //! A node of the tree. It is aligned to a cache line to avoid false sharing between the nodes.
+                struct alignas(ALPAKA_THREAD_BARRIER_CACHE_LINE_SIZE) Node
+                {
+                    //-----------------------------------------------------------------------------
+                    Node(
+                        TIdx const & childCount,
+                        std::size_t const & parent) :
+                            m_curChildCount(childCount),
+                            m_childCount(childCount),
+                            m_parent(parent)
+                    {}
+
+                    std::atomic<TIdx> m_curChildCount;
+                    TIdx const m_childCount;
+                    std::size_t const m_parent;
                 };
-            }
+                static_assert(
+                    sizeof(Node) % ALPAKA_THREAD_BARRIER_CACHE_LINE_SIZE == 0u,
+                    "The nodes of the tree barrier have to fill whole cache lines!");
+
+                //-----------------------------------------------------------------------------
+                //! \return The number of nodes of a tree for the given number of threads.
+                static auto getNodeCount(
+                    std::size_t const & threadCount)
+                -> std::size_t
+                {
+                    std::size_t const fanIn(ALPAKA_THREAD_BARRIER_TREE_FAN_IN);
+                    std::size_t nodeCount(0u);
+                    std::size_t levelChildCount(threadCount);
+                    do
+                    {
+                        levelChildCount = (levelChildCount + fanIn - 1u) / fanIn;
+                        nodeCount += levelChildCount;
+                    }
+                    while(levelChildCount > 1u);
+                    return nodeCount;
+                }
+                //-----------------------------------------------------------------------------
+                //! \return The index of the calling thread within this barrier.
+                auto getThreadIdx()
+                -> TIdx
+                {
+                    // The index of the thread is cached for the barrier it used last.
+                    thread_local std::uint64_t cachedBarrierId(0u);
+                    thread_local TIdx cachedThreadIdx(0u);
+                    if(cachedBarrierId != m_barrierId)
+                    {
+                        cachedBarrierId = m_barrierId;
+                        cachedThreadIdx = m_registeredThreadCount++;
+                        ALPAKA_ASSERT(cachedThreadIdx < m_threadCount);
+                    }
+                    return cachedThreadIdx;
+                }
+                //-----------------------------------------------------------------------------
+                //! \return The source of the unique barrier identifiers. Zero is never used.
+                static auto nextBarrierId()
+                -> std::atomic<std::uint64_t> &
+                {
+                    static std::atomic<std::uint64_t> barrierId(1u);
+                    return barrierId;
+                }
+
+            private:
+                const TIdx m_threadCount;
+                std::atomic<TIdx> m_registeredThreadCount;
+                std::uint64_t const m_barrierId;
+                std::size_t const m_nodeCount;
+                Node * const m_pNodes;          //!< The nodes of all levels starting at the leaves. The root is the last one.
+                detail::BarrierGeneration m_generation;
+            };
 
             //#############################################################################
-            //! A self-resetting barrier with barrier.
+            //! A self-resetting barrier reducing a predicate over all threads.
+            //!
+            //! The reduction is part of the arrival: Each thread adds itself and its predicate to a single packed counter.
+            //! The last arriving thread computes the result from the number of true predicates and releases the other threads like BarrierThread.
             template<
                 typename TIdx>
             class BarrierThreadWithPredicate final
@@ -147,9 +436,11 @@ namespace alpaka
                 explicit BarrierThreadWithPredicate(
                     TIdx const & threadCount) :
                     m_threadCount(threadCount),
-                    m_curThreadCount(threadCount),
-                    m_generation(0)
-                {}
+                    m_arrivals(0u),
+                    m_generation(detail::getBarrierSpinCount(threadCount))
+                {
+                    ALPAKA_ASSERT(static_cast<std::uint64_t>(threadCount) <= static_cast<std::uint64_t>(ArrivalMask));
+                }
                 //-----------------------------------------------------------------------------
                 BarrierThreadWithPredicate(BarrierThreadWithPredicate const & other) = delete;
                 //-----------------------------------------------------------------------------
@@ -163,45 +454,45 @@ namespace alpaka
 
                 //-----------------------------------------------------------------------------
                 //! Waits for all the other threads to reach the barrier.
+                //! \return The predicates of all threads reduced with TOp.
                 template<
                     typename TOp>
                 ALPAKA_FN_HOST auto wait(int predicate)
                 -> int
                 {
-                    TIdx const generationWhenEnteredTheWait = m_generation;
-                    std::unique_lock<std::mutex> lock(m_mtxBarrier);
+                    // The generation can not change before this thread has arrived.
+                    auto const generationWhenEnteredTheWait(m_generation.load());
+                    auto const generationMod2(generationWhenEnteredTheWait % 2u);
 
-                    auto const generationMod2(m_generation % static_cast<TIdx>(2u));
-                    if(m_curThreadCount == m_threadCount)
+                    auto const arrival(static_cast<std::uint64_t>(1u) + ((predicate != 0) ? TrueCountOne : static_cast<std::uint64_t>(0u)));
+                    auto const arrivals(m_arrivals.fetch_add(arrival, std::memory_order_acq_rel) + arrival);
+                    if((arrivals & ArrivalMask) == static_cast<std::uint64_t>(m_threadCount))
                     {
-                        m_result[generationMod2] = TOp::InitialValue;
-                    }
-
-                    std::atomic<int>& result(m_result[generationMod2]);
-                    bool const predicateBool(predicate != 0);
-
-                    detail::AtomicOp<TOp>()(result, predicateBool);
-
-                    if(--m_curThreadCount == 0)
-                    {
-                        m_curThreadCount = m_threadCount;
-                        ++m_generation;
-                        m_cvAllThreadsReachedBarrier.notify_all();
+                        // The result of the previous generation in this slot has been read by all threads because they arrived at the generation in between.
+                        m_result[generationMod2] =
+                            block::sync::detail::ReducePredicateCount<TOp>::reduce(
+                                static_cast<TIdx>(arrivals >> TrueCountShift),
+                                m_threadCount);
+                        m_arrivals.store(0u, std::memory_order_relaxed);
+                        m_generation.advance();
                     }
                     else
                     {
-                        m_cvAllThreadsReachedBarrier.wait(lock, [this, generationWhenEnteredTheWait] { return generationWhenEnteredTheWait != m_generation; });
+                        m_generation.waitWhile(generationWhenEnteredTheWait);
                     }
                     return m_result[generationMod2];
                 }
 
             private:
-                std::mutex m_mtxBarrier;
-                std::condition_variable m_cvAllThreadsReachedBarrier;
+                static constexpr std::uint32_t TrueCountShift = 32u;
+                static constexpr std::uint64_t TrueCountOne = static_cast<std::uint64_t>(1u) << TrueCountShift;
+                static constexpr std::uint64_t ArrivalMask = TrueCountOne - 1u;
+
                 const TIdx m_threadCount;
-                TIdx m_curThreadCount;
-                TIdx m_generation;
-                std::atomic<int> m_result[2];
+                //! The number of arrived threads in the lower and the number of true predicates in the upper 32 bits.
+                std::atomic<std::uint64_t> m_arrivals;
+                detail::BarrierGeneration m_generation;
+                int m_result[2];
             };
         }
     }
@@ -15,10 +15,12 @@
 // std::current_exception, std::make_exception_ptr, etc. which are not declared in device code.
 // Therefore, we can not even parse those parts when compiling device code.
 //-----------------------------------------------------------------------------
+#include <alpaka/core/Assert.hpp>
 #include <alpaka/core/Common.hpp>
 #include <alpaka/core/BoostPredef.hpp>
 
 #include <queue>
+#include <cstdint>
 #include <mutex>
 #include <stdexcept>
 #include <vector>
@@ -76,16 +78,389 @@ namespace alpaka
                     }
                     else
                     {
-                        t = std::queue<T>::front();
+                        t = std::move(std::queue<T>::front());
                         std::queue<T>::pop();
                         return true;
                     }
                 }
+                //-----------------------------------------------------------------------------
+                //! Pops the given value from the front of the queue.
+                //! All concurrent executors share the same queue so the index is ignored.
+                auto pop(
+                    std::size_t,
+                    T & t)
+                -> bool
+                {
+                    return pop(t);
+                }
+                //-----------------------------------------------------------------------------
+                //! All concurrent executors share the same queue so there is nothing to reserve.
+                auto reserve(
+                    std::size_t)
+                -> void
+                {}
 
             private:
                 std::mutex m_Mutex;
             };
 
+            //#############################################################################
+            //! A Chase-Lev work-stealing deque.
+            //!
+            //! The owning concurrent executor pushes and pops at the bottom without taking a lock.
+            //! Any other concurrent executor can steal from the top.
+            //! The ring buffer is grown when it is full. Old buffers are kept alive until destruction because thieves may still read from them.
+            //!
+            //! \tparam T The trivially copyable element type.
+            template<
+                typename T>
+            class ChaseLevDeque
+            {
+                static_assert(
+                    std::is_trivially_copyable<T>::value,
+                    "The elements of a ChaseLevDeque have to be trivially copyable!");
+
+                //#############################################################################
+                class RingBuffer
+                {
+                public:
+                    //-----------------------------------------------------------------------------
+                    explicit RingBuffer(
+                        std::int64_t capacity) :
+                            m_capacity(capacity),
+                            m_upElements(new std::atomic<T>[static_cast<std::size_t>(capacity)])
+                    {}
+                    //-----------------------------------------------------------------------------
+                    auto capacity() const
+                    -> std::int64_t
+                    {
+                        return m_capacity;
+                    }
+                    //-----------------------------------------------------------------------------
+                    auto load(
+                        std::int64_t i) const
+                    -> T
+                    {
+                        return m_upElements[static_cast<std::size_t>(i & (m_capacity - 1))].load(std::memory_order_relaxed);
+                    }
+                    //-----------------------------------------------------------------------------
+                    auto store(
+                        std::int64_t i,
+                        T t)
+                    -> void
+                    {
+                        m_upElements[static_cast<std::size_t>(i & (m_capacity - 1))].store(t, std::memory_order_relaxed);
+                    }
+
+                private:
+                    std::int64_t const m_capacity;  //!< Always a power of two.
+                    std::unique_ptr<std::atomic<T>[]> m_upElements;
+                };
+
+            public:
+                //-----------------------------------------------------------------------------
+                ChaseLevDeque() :
+                    m_top(0),
+                    m_bottom(0),
+                    m_pBuffer(nullptr)
+                {
+                    m_vupBuffers.emplace_back(std::make_unique<RingBuffer>(64));
+                    m_pBuffer.store(m_vupBuffers.back().get(), std::memory_order_relaxed);
+                }
+                //-----------------------------------------------------------------------------
+                ChaseLevDeque(ChaseLevDeque const &) = delete;
+                //-----------------------------------------------------------------------------
+                ChaseLevDeque(ChaseLevDeque &&) = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(ChaseLevDeque const &) -> ChaseLevDeque & = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(ChaseLevDeque &&) -> ChaseLevDeque & = delete;
+
+                //-----------------------------------------------------------------------------
+                //! Pushes the given value onto the bottom of the deque.
+                //! Must only be called by the owner.
+                auto push(
+                    T t)
+                -> void
+                {
+                    auto const bottom(m_bottom.load(std::memory_order_relaxed));
+                    auto const top(m_top.load(std::memory_order_acquire));
+                    auto * pBuffer(m_pBuffer.load(std::memory_order_relaxed));
+
+                    if(bottom - top > pBuffer->capacity() - 1)
+                    {
+                        auto upBuffer(std::make_unique<RingBuffer>(2 * pBuffer->capacity()));
+                        for(auto i(top); i < bottom; ++i)
+                        {
+                            upBuffer->store(i, pBuffer->load(i));
+                        }
+                        pBuffer = upBuffer.get();
+                        m_vupBuffers.emplace_back(std::move(upBuffer));
+                        m_pBuffer.store(pBuffer, std::memory_order_release);
+                    }
+
+                    pBuffer->store(bottom, t);
+                    std::atomic_thread_fence(std::memory_order_release);
+                    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                }
+                //-----------------------------------------------------------------------------
+                //! Pops a value from the bottom of the deque.
+                //! Must only be called by the owner.
+                auto pop(
+                    T & t)
+                -> bool
+                {
+                    auto const bottom(m_bottom.load(std::memory_order_relaxed) - 1);
+                    auto * const pBuffer(m_pBuffer.load(std::memory_order_relaxed));
+                    m_bottom.store(bottom, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    auto top(m_top.load(std::memory_order_relaxed));
+
+                    bool success(false);
+                    if(top <= bottom)
+                    {
+                        t = pBuffer->load(bottom);
+                        success = true;
+                        if(top == bottom)
+                        {
+                            // This is the last element. Race against the thieves for it.
+                            success = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                        }
+                    }
+                    else
+                    {
+                        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                    }
+                    return success;
+                }
+                //-----------------------------------------------------------------------------
+                //! Steals a value from the top of the deque.
+                //! Can be called by any concurrent executor. Fails spuriously if another thief or the owner won the race for the element.
+                auto steal(
+                    T & t)
+                -> bool
+                {
+                    auto top(m_top.load(std::memory_order_acquire));
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    auto const bottom(m_bottom.load(std::memory_order_acquire));
+
+                    if(top < bottom)
+                    {
+                        auto const value(m_pBuffer.load(std::memory_order_acquire)->load(top));
+                        if(m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                        {
+                            t = value;
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+            private:
+                std::atomic<std::int64_t> m_top;
+                std::atomic<std::int64_t> m_bottom;
+                std::atomic<RingBuffer *> m_pBuffer;
+                std::vector<std::unique_ptr<RingBuffer>> m_vupBuffers;
+            };
+
+            //#############################################################################
+            //! A task queue with one work-stealing deque per concurrent executor.
+            //!
+            //! Tasks are pushed round-robin into small per concurrent executor inboxes.
+            //! A concurrent executor moves the tasks from its inbox into its own lock-free deque and works on them.
+            //! When it runs out of work it steals from the deques and inboxes of randomly chosen other concurrent executors.
+            //! This avoids the single lock of ThreadSafeQueue every concurrent executor contends for.
+            //!
+            //! \tparam T The owning pointer type of the tasks (for example std::unique_ptr). The deques only store the raw pointers.
+            template<
+                typename T>
+            class WorkStealingQueue
+            {
+                using Ptr = typename T::pointer;
+
+                //#############################################################################
+                //! The queues owned by a single concurrent executor.
+                struct ConcurrentExecQueues
+                {
+                    ThreadSafeQueue<T> m_inbox;
+                    ChaseLevDeque<Ptr> m_deque;
+                    std::uint32_t m_stealSeed;  //!< The state of the random number generator choosing the victims. Only used by the owner.
+                };
+
+            public:
+                //-----------------------------------------------------------------------------
+                WorkStealingQueue() :
+                    m_pConcurrentExecQueues(nullptr),
+                    m_nextInbox(0u),
+                    m_numTasks(0u)
+                {
+                    m_vupSnapshots.emplace_back(std::make_unique<std::vector<ConcurrentExecQueues *>>());
+                    m_pConcurrentExecQueues.store(m_vupSnapshots.back().get(), std::memory_order_relaxed);
+                }
+                //-----------------------------------------------------------------------------
+                WorkStealingQueue(WorkStealingQueue const &) = delete;
+                //-----------------------------------------------------------------------------
+                WorkStealingQueue(WorkStealingQueue &&) = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(WorkStealingQueue const &) -> WorkStealingQueue & = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(WorkStealingQueue &&) -> WorkStealingQueue & = delete;
+                //-----------------------------------------------------------------------------
+                ~WorkStealingQueue()
+                {
+                    // Destroy the remaining tasks the deques only hold raw pointers to.
+                    T t;
+                    while(pop(t))
+                    {
+                        t.reset();
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                //! \return If the queue is empty.
+                auto empty() const
+                -> bool
+                {
+                    return m_numTasks.load() == 0u;
+                }
+                //-----------------------------------------------------------------------------
+                //! Pushes the given value into the inbox of the next concurrent executor.
+                auto push(
+                    T && t)
+                -> void
+                {
+                    auto const & concurrentExecQueues(*m_pConcurrentExecQueues.load(std::memory_order_acquire));
+                    // The pool reserves the queues of its concurrent executors before it accepts any task.
+                    ALPAKA_ASSERT(!concurrentExecQueues.empty());
+
+                    auto const inboxIdx(m_nextInbox.fetch_add(1u, std::memory_order_relaxed) % concurrentExecQueues.size());
+
+                    ++m_numTasks;
+                    concurrentExecQueues[inboxIdx]->m_inbox.push(std::forward<T>(t));
+                }
+                //-----------------------------------------------------------------------------
+                //! Pops a value for the given concurrent executor.
+                //! Must only be called by the concurrent executor with the given index.
+                auto pop(
+                    std::size_t concurrentExecIdx,
+                    T & t)
+                -> bool
+                {
+                    auto const & concurrentExecQueues(*m_pConcurrentExecQueues.load(std::memory_order_acquire));
+                    auto & own(*concurrentExecQueues[concurrentExecIdx]);
+
+                    Ptr p(nullptr);
+                    if(own.m_deque.pop(p))
+                    {
+                        t.reset(p);
+                        --m_numTasks;
+                        return true;
+                    }
+                    if(own.m_inbox.pop(t))
+                    {
+                        // Move the rest of the inbox into the deque so that other concurrent executors can steal it without locking.
+                        T next;
+                        while(own.m_inbox.pop(next))
+                        {
+                            own.m_deque.push(next.release());
+                        }
+                        --m_numTasks;
+                        return true;
+                    }
+
+                    // Steal from the other concurrent executors starting at a random victim.
+                    auto const concurrentExecCount(concurrentExecQueues.size());
+                    own.m_stealSeed ^= own.m_stealSeed << 13;
+                    own.m_stealSeed ^= own.m_stealSeed >> 17;
+                    own.m_stealSeed ^= own.m_stealSeed << 5;
+                    auto const firstVictimIdx(static_cast<std::size_t>(own.m_stealSeed) % concurrentExecCount);
+                    for(std::size_t i(0u); i < concurrentExecCount; ++i)
+                    {
+                        auto & victim(*concurrentExecQueues[(firstVictimIdx + i) % concurrentExecCount]);
+                        if(victim.m_deque.steal(p))
+                        {
+                            t.reset(p);
+                            --m_numTasks;
+                            return true;
+                        }
+                        if(victim.m_inbox.pop(t))
+                        {
+                            --m_numTasks;
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+                //-----------------------------------------------------------------------------
+                //! Pops any value.
+                //! Must not be called while concurrent executors pop from their own deques.
+                auto pop(
+                    T & t)
+                -> bool
+                {
+                    for(auto * pQueues : *m_pConcurrentExecQueues.load(std::memory_order_acquire))
+                    {
+                        Ptr p(nullptr);
+                        if(pQueues->m_deque.steal(p))
+                        {
+                            t.reset(p);
+                            --m_numTasks;
+                            return true;
+                        }
+                        if(pQueues->m_inbox.pop(t))
+                        {
+                            --m_numTasks;
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+                //-----------------------------------------------------------------------------
+                //! Creates the queues for at least the given number of concurrent executors.
+                //! This can be called while the existing concurrent executors are running but not concurrently with itself.
+                auto reserve(
+                    std::size_t concurrentExecutionCount)
+                -> void
+                {
+                    auto const & concurrentExecQueues(*m_pConcurrentExecQueues.load(std::memory_order_relaxed));
+                    if(concurrentExecQueues.size() < concurrentExecutionCount)
+                    {
+                        // The concurrent executors may still iterate the current snapshot so a new one is published instead of modifying it.
+                        auto upSnapshot(std::make_unique<std::vector<ConcurrentExecQueues *>>(concurrentExecQueues));
+                        while(upSnapshot->size() < concurrentExecutionCount)
+                        {
+                            m_vupConcurrentExecQueues.emplace_back(std::make_unique<ConcurrentExecQueues>());
+                            // The seed of the xorshift generator must not be zero.
+                            m_vupConcurrentExecQueues.back()->m_stealSeed = static_cast<std::uint32_t>(upSnapshot->size()) * 2654435761u + 1u;
+                            upSnapshot->push_back(m_vupConcurrentExecQueues.back().get());
+                        }
+                        m_pConcurrentExecQueues.store(upSnapshot.get(), std::memory_order_release);
+                        m_vupSnapshots.emplace_back(std::move(upSnapshot));
+                    }
+                }
+
+            private:
+                std::vector<std::unique_ptr<ConcurrentExecQueues>> m_vupConcurrentExecQueues;
+                std::vector<std::unique_ptr<std::vector<ConcurrentExecQueues *>>> m_vupSnapshots;   //!< All snapshots ever published. They are kept alive until destruction.
+                std::atomic<std::vector<ConcurrentExecQueues *> *> m_pConcurrentExecQueues;     //!< The current snapshot of the queues of all concurrent executors.
+                std::atomic<std::size_t> m_nextInbox;
+                std::atomic<std::size_t> m_numTasks;
+            };
+
+            //#############################################################################
+            //! The task queue used by the ConcurrentExecPool by default.
+            //! Defining ALPAKA_CPU_WORK_STEALING_ENABLED (CMake option ALPAKA_CPU_WORK_STEALING) selects the work-stealing queue.
+#ifdef ALPAKA_CPU_WORK_STEALING_ENABLED
+            template<
+                typename T>
+            using DefaultTaskQueue = WorkStealingQueue<T>;
+#else
+            template<
+                typename T>
+            using DefaultTaskQueue = ThreadSafeQueue<T>;
+#endif
+
             //#############################################################################
             //! ITaskPkg.
             // \NOTE: We can not use std::packaged_task as it forces the use of std::future
@@ -97,9 +472,29 @@ namespace alpaka
             class ITaskPkg
             {
             public:
+                //-----------------------------------------------------------------------------
+                ITaskPkg() = default;
+                //-----------------------------------------------------------------------------
+                ITaskPkg(ITaskPkg const &) = default;
+                //-----------------------------------------------------------------------------
+                ITaskPkg(ITaskPkg &&) = default;
+                //-----------------------------------------------------------------------------
+                auto operator=(ITaskPkg const &) -> ITaskPkg & = default;
+                //-----------------------------------------------------------------------------
+                auto operator=(ITaskPkg &&) -> ITaskPkg & = default;
                 //-----------------------------------------------------------------------------
                 virtual ~ITaskPkg() = default;
 
+                //-----------------------------------------------------------------------------
+                //! Releases this task after it has been executed or discarded.
+                //! Tasks allocated by the pool delete themselves, intrusive tasks signal their completion to the caller owning them.
+                //! This is the last access to the task.
+                virtual auto destroy() noexcept
+                -> void
+                {
+                    delete this;
+                }
+
                 //-----------------------------------------------------------------------------
                 //! Runs this task.
                 auto runTask() noexcept
@@ -137,6 +532,184 @@ namespace alpaka
     #pragma clang diagnostic pop
 #endif
 
+            //#############################################################################
+            //! The deleter of the tasks held by the task queues.
+            struct TaskPkgDeleter
+            {
+                //-----------------------------------------------------------------------------
+                auto operator()(
+                    ITaskPkg * pTaskPkg) const noexcept
+                -> void
+                {
+                    pTaskPkg->destroy();
+                }
+            };
+            //#############################################################################
+            //! The owning pointer to a task in a task queue.
+            using TaskPkgPtr = std::unique_ptr<ITaskPkg, TaskPkgDeleter>;
+
+            //#############################################################################
+            //! A latch counting down the completion of a fixed number of tasks.
+            //! A lightweight alternative to one std::future per task.
+            //!
+            //! \tparam TMutex The mutex type used for waiting (for example std::mutex or boost::fibers::mutex).
+            //! \tparam TCondVar The condition variable type used for waiting.
+            template<
+                typename TMutex,
+                typename TCondVar>
+            class CompletionLatch final
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                //! \param count The number of tasks which have to complete.
+                explicit CompletionLatch(
+                    std::size_t count) :
+                        m_count(count),
+                        m_bDone(count == 0u)
+                {}
+                //-----------------------------------------------------------------------------
+                CompletionLatch(CompletionLatch const &) = delete;
+                //-----------------------------------------------------------------------------
+                CompletionLatch(CompletionLatch &&) = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(CompletionLatch const &) -> CompletionLatch & = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(CompletionLatch &&) -> CompletionLatch & = delete;
+
+                //-----------------------------------------------------------------------------
+                //! Signals the completion of one task.
+                auto countDown()
+                -> void
+                {
+                    // Only the last task takes the lock.
+                    if(--m_count == 0u)
+                    {
+                        std::lock_guard<TMutex> lock(m_mtxDone);
+                        m_bDone = true;
+                        m_cvDone.notify_all();
+                    }
+                }
+// Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
+#if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
+                //-----------------------------------------------------------------------------
+                //! Signals the completion of one task with an exception.
+                //! Only the first exception is kept.
+                auto countDown(
+                    std::exception_ptr const & exceptPtr)
+                -> void
+                {
+                    {
+                        std::lock_guard<TMutex> lock(m_mtxDone);
+                        if(!m_exceptPtr)
+                        {
+                            m_exceptPtr = exceptPtr;
+                        }
+                    }
+                    countDown();
+                }
+#endif
+                //-----------------------------------------------------------------------------
+                //! Waits until all tasks have completed.
+                //! Rethrows the first exception thrown by any of the tasks.
+                auto wait()
+                -> void
+                {
+                    std::unique_lock<TMutex> lock(m_mtxDone);
+                    m_cvDone.wait(lock, [this](){return m_bDone;});
+// Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
+#if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
+                    if(m_exceptPtr)
+                    {
+                        std::rethrow_exception(m_exceptPtr);
+                    }
+#endif
+                }
+
+            private:
+                std::atomic<std::size_t> m_count;
+                // The waiting thread checks this flag instead of the counter so that it can not destroy the latch while the last task still notifies.
+                bool m_bDone;
+                TMutex m_mtxDone;
+                TCondVar m_cvDone;
+#if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
+                std::exception_ptr m_exceptPtr;
+#endif
+            };
+
+            //#############################################################################
+            //! A task whose storage is owned by the caller.
+            //!
+            //! Enqueueing it via ConcurrentExecPool::enqueueIntrusiveTask does not allocate.
+            //! The function object is stored inline instead of being type-erased on the heap.
+            //! Its completion is signaled to a CompletionLatch shared by many tasks instead of a promise.
+            //! The task must neither be moved nor destroyed until the latch has been waited for.
+            //!
+            //! \tparam TLatch The latch type signaled on completion.
+            //! \tparam TFnObj The type of the function to execute.
+            template<
+                typename TLatch,
+                typename TFnObj>
+            class IntrusiveTaskPkg final :
+                public ITaskPkg
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                IntrusiveTaskPkg(
+                    TLatch & latch,
+                    TFnObj && func) :
+                        m_pLatch(&latch),
+                        m_pNumActiveTasks(nullptr),
+                        m_FnObj(std::move(func))
+                {}
+
+                //-----------------------------------------------------------------------------
+                //! The caller owns the task. Signals the completion to the latch.
+                //! The caller may destroy the task as soon as the latch is released so it must not be touched afterwards.
+                virtual auto destroy() noexcept
+                -> void final
+                {
+                    --(*m_pNumActiveTasks);
+// Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
+#if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
+                    if(m_exceptPtr)
+                    {
+                        m_pLatch->countDown(m_exceptPtr);
+                        return;
+                    }
+#endif
+                    m_pLatch->countDown();
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                //! The execution function.
+                virtual auto run()
+                -> void final
+                {
+                    this->m_FnObj();
+                }
+            public:
+// Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
+#if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
+                //-----------------------------------------------------------------------------
+                //! Sets an exception.
+                virtual auto setException(
+                    std::exception_ptr const & exceptPtr)
+                -> void final
+                {
+                    m_exceptPtr = exceptPtr;
+                }
+#endif
+                TLatch * m_pLatch;
+                //! The active task counter of the pool this task is enqueued into. Set by the pool.
+                std::atomic<std::uint32_t> * m_pNumActiveTasks;
+            private:
+                std::remove_reference_t<TFnObj> m_FnObj;
+#if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
+                std::exception_ptr m_exceptPtr;
+#endif
+            };
+
             //#############################################################################
             template<
                 template<typename TFnObjReturn> class TPromise,
@@ -242,6 +815,56 @@ namespace alpaka
                 std::remove_reference_t<TFnObj> m_FnObj;
             };
 
+            //#############################################################################
+            //! TaskPkg without a promise notifying waiting threads.
+            //! The notification is also executed if the task is discarded so that waiting threads never wait forever.
+            //! Exceptions thrown by the notification are discarded.
+            //!
+            //! \tparam TFnObj The type of the function to execute.
+            template<
+                typename TFnObj>
+            class NotificationTaskPkg final :
+                public ITaskPkg
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                NotificationTaskPkg(
+                    TFnObj && func) :
+                        m_bExecuted(false),
+                        m_FnObj(std::move(func))
+                {}
+
+            private:
+                //-----------------------------------------------------------------------------
+                //! The execution function.
+                virtual auto run()
+                -> void final
+                {
+                    m_bExecuted = true;
+                    this->m_FnObj();
+                }
+            public:
+// Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
+#if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
+                //-----------------------------------------------------------------------------
+                //! Executes the notification if the task has been discarded before it has been executed.
+                virtual auto setException(
+                    std::exception_ptr const &)
+                -> void final
+                {
+                    if(!m_bExecuted)
+                    {
+                        runTask();
+                    }
+                }
+#endif
+            private:
+                bool m_bExecuted;
+                // NOTE: To avoid invalid memory accesses to memory of a different thread
+                // `std::remove_reference` enforces the function object to be copied.
+                std::remove_reference_t<TFnObj> m_FnObj;
+            };
+
             //-----------------------------------------------------------------------------
             template<
                 typename TFnObj0,
@@ -279,6 +902,7 @@ namespace alpaka
             //! \tparam TMutex Unused. The mutex type used for locking threads.
             //! \tparam TCondVar Unused. The condition variable type used to make the threads wait if there is no work.
             //! \tparam TisYielding Boolean value if the threads should yield instead of wait for a condition variable.
+            //! \tparam TTaskQueue The queue holding the tasks not yet worked on (ThreadSafeQueue or WorkStealingQueue).
             template<
                 typename TIdx,
                 typename TConcurrentExec,
@@ -286,7 +910,8 @@ namespace alpaka
                 typename TYield,
                 typename TMutex = void,
                 typename TCondVar = void,
-                bool TisYielding = true>
+                bool TisYielding = true,
+                template<typename TTask> class TTaskQueue = DefaultTaskQueue>
             class ConcurrentExecPool final
             {
             public:
@@ -309,11 +934,12 @@ namespace alpaka
                     }
 
                     m_vConcurrentExecs.reserve(static_cast<std::size_t>(concurrentExecutionCount));
+                    m_qTasks.reserve(static_cast<std::size_t>(concurrentExecutionCount));
 
                     // Create all concurrent executors.
-                    for(TIdx concurrentExec(0u); concurrentExec < concurrentExecutionCount; ++concurrentExec)
+                    for(std::size_t concurrentExecIdx(0u); concurrentExecIdx < static_cast<std::size_t>(concurrentExecutionCount); ++concurrentExecIdx)
                     {
-                        m_vConcurrentExecs.emplace_back([this](){concurrentExecFn();});
+                        m_vConcurrentExecs.emplace_back([this, concurrentExecIdx](){concurrentExecFn(concurrentExecIdx);});
                     }
                 }
                 //-----------------------------------------------------------------------------
@@ -335,7 +961,7 @@ namespace alpaka
 
                     joinAllConcurrentExecs();
 
-                    auto currentTaskPackage = std::shared_ptr<ITaskPkg>{nullptr};
+                    auto currentTaskPackage = TaskPkgPtr{nullptr};
 
                     // Signal to each incomplete task that it will not complete due to pool destruction.
                     while(popTask(currentTaskPackage))
@@ -368,21 +994,21 @@ namespace alpaka
                     TArgs && ... args)
                 {
                     auto boundTask([=](){return task(args...);});
-                    auto decrementNumActiveTasks([this](){--m_numActiveTasks;});
 
+                    // The bound task is moved instead of copied into the task package.
                     auto extendedTask(
-                        [boundTask, decrementNumActiveTasks]()
+                        [this, boundTask = std::move(boundTask)]()
                         {
                             return
                                 invokeBothReturnFirst(
-                                    std::move(boundTask),
-                                    std::move(decrementNumActiveTasks)
+                                    boundTask,
+                                    [this](){--m_numActiveTasks;}
                                 );
                         });
 
                     using TaskPackage = TaskPkg<TPromise, decltype(extendedTask)>;
                     auto pTaskPackage(new TaskPackage(std::move(extendedTask)));
-                    std::shared_ptr<ITaskPkg> upTaskPackage(pTaskPackage);
+                    TaskPkgPtr upTaskPackage(pTaskPackage);
 
                     auto future(pTaskPackage->m_Promise.get_future());
 
@@ -392,6 +1018,44 @@ namespace alpaka
                     return future;
                 }
                 //-----------------------------------------------------------------------------
+                //! Runs the given caller-owned task on one of the pool without allocating memory.
+                //!
+                //! \param task The task. It must stay alive and must not be moved until its latch has been waited for.
+                template<
+                    typename TLatch,
+                    typename TFnObj>
+                auto enqueueIntrusiveTask(
+                    IntrusiveTaskPkg<TLatch, TFnObj> & task)
+                -> void
+                {
+                    task.m_pNumActiveTasks = &m_numActiveTasks;
+
+                    ++m_numActiveTasks;
+                    m_qTasks.push(TaskPkgPtr(&task));
+                }
+                //-----------------------------------------------------------------------------
+                //! Adds concurrent executors until the pool holds at least the given number of them.
+                //! The pool never shrinks. This must not be called concurrently with itself.
+                //!
+                //! \param concurrentExecutionCount The minimum number of concurrent executors the pool should hold.
+                auto reserveConcurrentExecutionCount(
+                    TIdx concurrentExecutionCount)
+                -> void
+                {
+                    auto const count(static_cast<std::size_t>(concurrentExecutionCount));
+                    if(m_vConcurrentExecs.size() < count)
+                    {
+                        m_vConcurrentExecs.reserve(count);
+                        m_qTasks.reserve(count);
+
+                        while(m_vConcurrentExecs.size() < count)
+                        {
+                            auto const concurrentExecIdx(m_vConcurrentExecs.size());
+                            m_vConcurrentExecs.emplace_back([this, concurrentExecIdx](){concurrentExecFn(concurrentExecIdx);});
+                        }
+                    }
+                }
+                //-----------------------------------------------------------------------------
                 //! \return The number of concurrent executors available.
                 auto getConcurrentExecutionCount() const
                 -> TIdx
@@ -409,17 +1073,19 @@ namespace alpaka
             private:
                 //-----------------------------------------------------------------------------
                 //! The function the concurrent executors are executing.
-                void concurrentExecFn()
+                void concurrentExecFn(
+                    std::size_t concurrentExecIdx)
                 {
                     // Checks whether pool is being destroyed, if so, stop running.
                     while(!m_bShutdownFlag.load(std::memory_order_relaxed))
                     {
-                        auto currentTaskPackage = std::shared_ptr<ITaskPkg>{nullptr};
+                        auto currentTaskPackage = TaskPkgPtr{nullptr};
 
-                        // Use popTask so we only ever have one reference to the ITaskPkg
-                        if(popTask(currentTaskPackage))
+                        if(m_qTasks.pop(concurrentExecIdx, currentTaskPackage))
                         {
                             currentTaskPackage->runTask();
+                            // Releasing the task signals the completion of intrusive tasks so this has to happen before waiting for new ones.
+                            currentTaskPackage.reset();
                         }
                         else
                         {
@@ -440,7 +1106,7 @@ namespace alpaka
                 //-----------------------------------------------------------------------------
                 //! Pops a task from the queue.
                 auto popTask(
-                    std::shared_ptr<ITaskPkg> & out)
+                    TaskPkgPtr & out)
                 -> bool
                 {
                     if(m_qTasks.pop(out))
@@ -452,7 +1118,7 @@ namespace alpaka
 
             private:
                 std::vector<TConcurrentExec> m_vConcurrentExecs;
-                ThreadSafeQueue<std::shared_ptr<ITaskPkg>> m_qTasks;
+                TTaskQueue<TaskPkgPtr> m_qTasks;
                 std::atomic<std::uint32_t> m_numActiveTasks;
                 std::atomic<bool> m_bShutdownFlag;
             };
@@ -465,13 +1131,15 @@ namespace alpaka
             //! \tparam TYield Unused. The type is required to have a static method "void yield()" to yield the current thread if there is no work.
             //! \tparam TMutex The mutex type used for locking threads.
             //! \tparam TCondVar The condition variable type used to make the threads wait if there is no work.
+            //! \tparam TTaskQueue The queue holding the tasks not yet worked on (ThreadSafeQueue or WorkStealingQueue).
             template<
                 typename TIdx,
                 typename TConcurrentExec,
                 template<typename TFnObjReturn> class TPromise,
                 typename TYield,
                 typename TMutex,
-                typename TCondVar>
+                typename TCondVar,
+                template<typename TTask> class TTaskQueue>
             class ConcurrentExecPool<
                 TIdx,
                 TConcurrentExec,
@@ -479,7 +1147,8 @@ namespace alpaka
                 TYield,
                 TMutex,
                 TCondVar,
-                false> final
+                false,
+                TTaskQueue> final
             {
             public:
                 //-----------------------------------------------------------------------------
@@ -503,11 +1172,12 @@ namespace alpaka
                     }
 
                     m_vConcurrentExecs.reserve(static_cast<std::size_t>(concurrentExecutionCount));
+                    m_qTasks.reserve(static_cast<std::size_t>(concurrentExecutionCount));
 
                     // Create all concurrent executors.
-                    for(TIdx concurrentExec(0u); concurrentExec < concurrentExecutionCount; ++concurrentExec)
+                    for(std::size_t concurrentExecIdx(0u); concurrentExecIdx < static_cast<std::size_t>(concurrentExecutionCount); ++concurrentExecIdx)
                     {
-                        m_vConcurrentExecs.emplace_back([this](){concurrentExecFn();});
+                        m_vConcurrentExecs.emplace_back([this, concurrentExecIdx](){concurrentExecFn(concurrentExecIdx);});
                     }
                 }
                 //-----------------------------------------------------------------------------
@@ -535,7 +1205,7 @@ namespace alpaka
 
                     joinAllConcurrentExecs();
 
-                    auto currentTaskPackage = std::shared_ptr<ITaskPkg>{nullptr};
+                    auto currentTaskPackage = TaskPkgPtr{nullptr};
 
                     // Signal to each incomplete task that it will not complete due to pool destruction.
                     while(popTask(currentTaskPackage))
@@ -568,21 +1238,21 @@ namespace alpaka
                     TArgs && ... args)
                 {
                     auto boundTask([=](){return task(args...);});
-                    auto decrementNumActiveTasks([this](){--m_numActiveTasks;});
 
+                    // The bound task is moved instead of copied into the task package.
                     auto extendedTask(
-                        [boundTask, decrementNumActiveTasks]()
+                        [this, boundTask = std::move(boundTask)]()
                         {
                             return
                                 invokeBothReturnFirst(
-                                    std::move(boundTask),
-                                    std::move(decrementNumActiveTasks)
+                                    boundTask,
+                                    [this](){--m_numActiveTasks;}
                                 );
                         });
 
                     using TaskPackage = TaskPkg<TPromise, decltype(extendedTask)>;
                     auto pTaskPackage(new TaskPackage(std::move(extendedTask)));
-                    std::shared_ptr<ITaskPkg> upTaskPackage(pTaskPackage);
+                    TaskPkgPtr upTaskPackage(pTaskPackage);
 
                     auto future(pTaskPackage->m_Promise.get_future());
 
@@ -597,6 +1267,49 @@ namespace alpaka
                     return future;
                 }
                 //-----------------------------------------------------------------------------
+                //! Runs the given caller-owned task on one of the pool without allocating memory.
+                //!
+                //! \param task The task. It must stay alive and must not be moved until its latch has been waited for.
+                template<
+                    typename TLatch,
+                    typename TFnObj>
+                auto enqueueIntrusiveTask(
+                    IntrusiveTaskPkg<TLatch, TFnObj> & task)
+                -> void
+                {
+                    task.m_pNumActiveTasks = &m_numActiveTasks;
+
+                    ++m_numActiveTasks;
+                    {
+                        std::lock_guard<TMutex> lock(m_mtxWakeup);
+                        m_qTasks.push(TaskPkgPtr(&task));
+
+                        m_cvWakeup.notify_one();
+                    }
+                }
+                //-----------------------------------------------------------------------------
+                //! Adds concurrent executors until the pool holds at least the given number of them.
+                //! The pool never shrinks. This must not be called concurrently with itself.
+                //!
+                //! \param concurrentExecutionCount The minimum number of concurrent executors the pool should hold.
+                auto reserveConcurrentExecutionCount(
+                    TIdx concurrentExecutionCount)
+                -> void
+                {
+                    auto const count(static_cast<std::size_t>(concurrentExecutionCount));
+                    if(m_vConcurrentExecs.size() < count)
+                    {
+                        m_vConcurrentExecs.reserve(count);
+                        m_qTasks.reserve(count);
+
+                        while(m_vConcurrentExecs.size() < count)
+                        {
+                            auto const concurrentExecIdx(m_vConcurrentExecs.size());
+                            m_vConcurrentExecs.emplace_back([this, concurrentExecIdx](){concurrentExecFn(concurrentExecIdx);});
+                        }
+                    }
+                }
+                //-----------------------------------------------------------------------------
                 //! \return The number of concurrent executors available.
                 auto getConcurrentExecutionCount() const
                 -> TIdx
@@ -614,17 +1327,19 @@ namespace alpaka
             private:
                 //-----------------------------------------------------------------------------
                 //! The function the concurrent executors are executing.
-                void concurrentExecFn()
+                void concurrentExecFn(
+                    std::size_t concurrentExecIdx)
                 {
                     // Checks whether pool is being destroyed, if so, stop running (lazy check without mutex).
                     while(!m_bShutdownFlag)
                     {
-                        auto currentTaskPackage = std::shared_ptr<ITaskPkg>{nullptr};
+                        auto currentTaskPackage = TaskPkgPtr{nullptr};
 
-                        // Use popTask so we only ever have one reference to the ITaskPkg
-                        if(popTask(currentTaskPackage))
+                        if(m_qTasks.pop(concurrentExecIdx, currentTaskPackage))
                         {
                             currentTaskPackage->runTask();
+                            // Releasing the task signals the completion of intrusive tasks so this has to happen before waiting for new ones.
+                            currentTaskPackage.reset();
                         }
                         {
                             std::unique_lock<TMutex> lock(m_mtxWakeup);
@@ -654,7 +1369,7 @@ namespace alpaka
                 //-----------------------------------------------------------------------------
                 //! Pops a task from the queue.
                 auto popTask(
-                    std::shared_ptr<ITaskPkg> & out)
+                    TaskPkgPtr & out)
                 -> bool
                 {
                     if(m_qTasks.pop(out))
@@ -666,7 +1381,7 @@ namespace alpaka
 
             private:
                 std::vector<TConcurrentExec> m_vConcurrentExecs;
-                ThreadSafeQueue<std::shared_ptr<ITaskPkg>> m_qTasks;
+                TTaskQueue<TaskPkgPtr> m_qTasks;
                 std::atomic<std::uint32_t> m_numActiveTasks;
 
                 TMutex m_mtxWakeup;
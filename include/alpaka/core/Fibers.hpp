@@ -34,6 +34,7 @@
 #include <boost/fiber/mutex.hpp>
 #include <boost/fiber/future.hpp>
 #include <boost/fiber/barrier.hpp>
+#include <boost/fiber/pooled_fixedsize_stack.hpp>
 
 #if BOOST_COMP_MSVC
     #undef NOMINMAX
@@ -0,0 +1,172 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#ifdef ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLED
+
+#include <alpaka/core/BoostPredef.hpp>
+#include <alpaka/core/Common.hpp>
+
+#if BOOST_COMP_MSVC
+    #pragma warning(push)
+    #pragma warning(disable: 4100)  // boost/context/detail/apply.hpp(31): warning C4100: "tpl": unreferenced formal parameter
+    #pragma warning(disable: 4702)  // boost/context/continuation_fcontext.hpp: warning C4702: unreachable code
+#endif
+
+// Boost context:
+// http://www.boost.org/doc/libs/develop/libs/context/doc/html/index.html
+#include <boost/context/continuation.hpp>
+#include <boost/context/pooled_fixedsize_stack.hpp>
+
+#if BOOST_COMP_MSVC
+    #pragma warning(pop)
+#endif
+
+#include <exception>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace alpaka
+{
+    namespace core
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! Executes the threads of a block one after the other on the calling thread.
+            //!
+            //! Each block thread runs on its own stack until it reaches a synchronization point where it yields to the next block thread.
+            //! The code between two synchronization points is thereby executed like a loop over all block threads which is split at the synchronization points.
+            //! The block threads are switched in a fixed round-robin order without any locking, so a switch only costs saving and restoring the registers.
+            template<
+                typename TIdx>
+            class LaneScheduler
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST LaneScheduler() :
+                        m_activeLaneIdx(static_cast<TIdx>(0u))
+                {}
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST LaneScheduler(LaneScheduler const &) = delete;
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST LaneScheduler(LaneScheduler &&) = delete;
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator=(LaneScheduler const &) -> LaneScheduler & = delete;
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator=(LaneScheduler &&) -> LaneScheduler & = delete;
+                //-----------------------------------------------------------------------------
+                /*virtual*/ ~LaneScheduler() = default;
+
+                //-----------------------------------------------------------------------------
+                //! Executes laneFn(blockThreadIdx) for all block threads and returns when all of them have finished.
+                //! If a block thread throws, the remaining block threads are unwound and the first exception is rethrown.
+                template<
+                    typename TLaneFn>
+                ALPAKA_FN_HOST auto run(
+                    TIdx const & blockThreadCount,
+                    TLaneFn const & laneFn)
+                -> void
+                {
+                    auto const laneCount(static_cast<std::size_t>(blockThreadCount));
+                    m_lanes.resize(laneCount);
+                    m_sinks.resize(laneCount);
+                    std::exception_ptr exception;
+
+                    auto unfinishedLaneCount(laneCount);
+                    for(std::size_t laneIdx(0u); laneIdx < laneCount; ++laneIdx)
+                    {
+                        m_activeLaneIdx = static_cast<TIdx>(laneIdx);
+                        m_lanes[laneIdx] = boost::context::callcc(
+                            std::allocator_arg,
+                            getStackPool(),
+                            [this, &laneFn, &exception, laneIdx](boost::context::continuation && sink)
+                            {
+                                m_sinks[laneIdx] = std::move(sink);
+                                try
+                                {
+                                    laneFn(static_cast<TIdx>(laneIdx));
+                                }
+                                catch(boost::context::detail::forced_unwind const &)
+                                {
+                                    throw;
+                                }
+                                catch(...)
+                                {
+                                    if(!exception)
+                                    {
+                                        exception = std::current_exception();
+                                    }
+                                }
+                                return std::move(m_sinks[laneIdx]);
+                            });
+                        if(!m_lanes[laneIdx])
+                        {
+                            --unfinishedLaneCount;
+                        }
+                    }
+
+                    while((unfinishedLaneCount > 0u) && !exception)
+                    {
+                        for(std::size_t laneIdx(0u); laneIdx < laneCount; ++laneIdx)
+                        {
+                            if(m_lanes[laneIdx])
+                            {
+                                m_activeLaneIdx = static_cast<TIdx>(laneIdx);
+                                m_lanes[laneIdx] = std::move(m_lanes[laneIdx]).resume();
+                                if(!m_lanes[laneIdx])
+                                {
+                                    --unfinishedLaneCount;
+                                }
+                            }
+                        }
+                    }
+
+                    if(exception)
+                    {
+                        // Destroying the suspended block threads unwinds their stacks.
+                        m_lanes.clear();
+                        m_sinks.clear();
+                        std::rethrow_exception(exception);
+                    }
+                }
+                //-----------------------------------------------------------------------------
+                //! Suspends the running block thread and continues with the next unfinished one.
+                ALPAKA_FN_HOST auto yield() const
+                -> void
+                {
+                    auto & sink(m_sinks[static_cast<std::size_t>(m_activeLaneIdx)]);
+                    sink = std::move(sink).resume();
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                //! \return The stack pool of the calling thread.
+                ALPAKA_FN_HOST static auto getStackPool()
+                -> boost::context::pooled_fixedsize_stack &
+                {
+                    // The block threads never migrate between threads, so each thread can use its own pool without locking.
+                    thread_local boost::context::pooled_fixedsize_stack stackPool;
+                    return stackPool;
+                }
+
+            public:
+                TIdx m_activeLaneIdx;                                               //!< The linear index of the running block thread. It is set before a block thread is resumed.
+
+            private:
+                std::vector<boost::context::continuation> m_lanes;                  //!< The suspended block threads.
+                std::vector<boost::context::continuation> mutable m_sinks;          //!< The continuations of the scheduler the block threads return to.
+            };
+        }
+    }
+}
+
+#endif
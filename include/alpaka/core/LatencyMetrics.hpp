@@ -0,0 +1,61 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+
+namespace alpaka
+{
+    namespace core
+    {
+        //#############################################################################
+        //! Statistics of the time work waited before it has been started.
+        class LatencyMetrics final
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            LatencyMetrics() :
+                    m_count(0u),
+                    m_total(0),
+                    m_max(0)
+            {}
+
+            //-----------------------------------------------------------------------------
+            //! Adds the given latency to the statistics.
+            ALPAKA_FN_HOST auto record(
+                std::chrono::nanoseconds const latency)
+            -> void
+            {
+                ++m_count;
+                m_total += latency;
+                m_max = std::max(m_max, latency);
+            }
+            //-----------------------------------------------------------------------------
+            //! \return The mean latency or zero if nothing has been recorded.
+            ALPAKA_FN_HOST auto getMean() const
+            -> std::chrono::nanoseconds
+            {
+                return
+                    (m_count == 0u)
+                    ? std::chrono::nanoseconds(0)
+                    : m_total / static_cast<std::chrono::nanoseconds::rep>(m_count);
+            }
+
+        public:
+            std::size_t m_count;                //!< The number of recorded latencies.
+            std::chrono::nanoseconds m_total;   //!< The sum of the recorded latencies.
+            std::chrono::nanoseconds m_max;     //!< The largest recorded latency.
+        };
+    }
+}
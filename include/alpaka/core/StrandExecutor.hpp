@@ -0,0 +1,687 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/BoostPredef.hpp>
+#include <alpaka/core/ConcurrentExecPool.hpp>
+#include <alpaka/core/LatencyMetrics.hpp>
+#include <alpaka/queue/Properties.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <future>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+//-----------------------------------------------------------------------------
+//! The number of tasks a strand executes before it lets the other ready strands run.
+#ifndef ALPAKA_CPU_STRAND_BATCH_SIZE
+    #define ALPAKA_CPU_STRAND_BATCH_SIZE 16
+#endif
+//-----------------------------------------------------------------------------
+//! The time in milliseconds an idle worker of a strand executor waits for new work before it exits.
+#ifndef ALPAKA_CPU_STRAND_EXECUTOR_KEEP_ALIVE_MS
+    #define ALPAKA_CPU_STRAND_EXECUTOR_KEEP_ALIVE_MS 1000
+#endif
+//-----------------------------------------------------------------------------
+//! The time in milliseconds a ready strand may wait for a worker before it is preferred over the strands of higher priorities.
+#ifndef ALPAKA_CPU_STRAND_EXECUTOR_AGING_MS
+    #define ALPAKA_CPU_STRAND_EXECUTOR_AGING_MS 100
+#endif
+
+namespace alpaka
+{
+    namespace core
+    {
+        namespace detail
+        {
+            class Strand;
+
+            //#############################################################################
+            //! Executes many strands on a small number of shared worker threads.
+            //!
+            //! The workers are started on demand, at most one per hardware thread.
+            //! Idle workers exit after ALPAKA_CPU_STRAND_EXECUTOR_KEEP_ALIVE_MS, so an idle executor does not hold any worker.
+            //! Tasks may block (e.g. a queue waiting for an event of another queue) so a fixed number of workers could dead-lock.
+            //! Therefore tasks which wait for other strands mark their worker as blocked, see BlockingScope, and a replacement is started right away.
+            //! The number of workers which are not blocked never exceeds the maximum, so CPU bound strands do not oversubscribe the cores.
+            //!
+            //! Ready strands are picked up in the order of their priority and in FIFO order within a priority.
+            //! A strand which has waited for more than ALPAKA_CPU_STRAND_EXECUTOR_AGING_MS is picked up first, so low priorities are not starved.
+            class StrandExecutor final
+            {
+                //! The number of queue priorities.
+                static constexpr std::size_t priorityCount = static_cast<std::size_t>(queue::Priority::High) + 1u;
+
+                //#############################################################################
+                //! A strand waiting for a worker.
+                struct ReadyStrand
+                {
+                    Strand * m_pStrand;
+                    std::chrono::steady_clock::time_point m_readyTime;
+                };
+
+            public:
+                //-----------------------------------------------------------------------------
+                //! \param workerCountMax The maximum number of workers which are not blocked.
+                //! \param agingTime The time a ready strand may wait for a worker before it is preferred over the strands of higher priorities.
+                explicit StrandExecutor(
+                    std::size_t const workerCountMax = std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), static_cast<std::size_t>(1u)),
+                    std::chrono::milliseconds const agingTime = std::chrono::milliseconds(ALPAKA_CPU_STRAND_EXECUTOR_AGING_MS)) :
+                        m_workerCountMax(workerCountMax),
+                        m_agingTime(agingTime),
+                        m_workerCount(0u),
+                        m_idleWorkerCount(0u),
+                        m_blockedWorkerCount(0u),
+                        m_readyStrandCount(0u),
+                        m_bShutdownFlag(false)
+                {}
+                //-----------------------------------------------------------------------------
+                StrandExecutor(StrandExecutor const &) = delete;
+                //-----------------------------------------------------------------------------
+                StrandExecutor(StrandExecutor &&) = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(StrandExecutor const &) -> StrandExecutor & = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(StrandExecutor &&) -> StrandExecutor & = delete;
+                //-----------------------------------------------------------------------------
+                //! All strands have to be destroyed before their executor.
+                ~StrandExecutor()
+                {
+                    std::unique_lock<std::mutex> lock(m_mtx);
+                    m_bShutdownFlag = true;
+                    m_cvWakeup.notify_all();
+                    m_cvWorkerExit.wait(lock, [this](){return m_workerCount == 0u;});
+                    joinExitedWorkers();
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Appends the given strand to the strands waiting for a worker.
+                //! A strand must not be scheduled again before it has been executed.
+                auto schedule(
+                    Strand & strand)
+                -> void;
+                //-----------------------------------------------------------------------------
+                //! Removes the given strand from the strands waiting for a worker.
+                //! \return If the strand was waiting. Otherwise it may be executed by a worker right now.
+                auto unschedule(
+                    Strand & strand)
+                -> bool;
+                //#############################################################################
+                //! Marks the calling thread as blocked for the lifetime of the scope if it is a worker of any executor.
+                //!
+                //! Every wait of a task for other strands has to be enclosed in a blocking scope.
+                //! Otherwise the executor may not start a worker for the strands the task waits for.
+                class BlockingScope final
+                {
+                public:
+                    //-----------------------------------------------------------------------------
+                    BlockingScope() :
+                        m_pExecutor(getCurrentExecutor())
+                    {
+                        if(m_pExecutor && !m_pExecutor->beginBlocking())
+                        {
+                            m_pExecutor = nullptr;
+                        }
+                    }
+                    //-----------------------------------------------------------------------------
+                    BlockingScope(BlockingScope const &) = delete;
+                    //-----------------------------------------------------------------------------
+                    BlockingScope(BlockingScope &&) = delete;
+                    //-----------------------------------------------------------------------------
+                    auto operator=(BlockingScope const &) -> BlockingScope & = delete;
+                    //-----------------------------------------------------------------------------
+                    auto operator=(BlockingScope &&) -> BlockingScope & = delete;
+                    //-----------------------------------------------------------------------------
+                    ~BlockingScope()
+                    {
+                        if(m_pExecutor)
+                        {
+                            m_pExecutor->endBlocking();
+                        }
+                    }
+
+                private:
+                    StrandExecutor * m_pExecutor;   //!< The executor the calling worker has been marked as blocked in or nullptr.
+                };
+
+                //-----------------------------------------------------------------------------
+                //! Marks the calling worker as blocked until endBlocking is called.
+                //!
+                //! A task which waits for other strands of the same executor calls this before it waits.
+                //! The blocked worker does not count against the maximum number of workers.
+                //! This does nothing if the calling thread is not a worker of this executor or if it is already marked.
+                //!
+                //! \return If the calling worker has been marked. Only then endBlocking has to be called.
+                auto beginBlocking()
+                -> bool
+                {
+                    if((getCurrentExecutor() != this) || isCurrentWorkerBlocked())
+                    {
+                        return false;
+                    }
+                    isCurrentWorkerBlocked() = true;
+
+                    std::lock_guard<std::mutex> lock(m_mtx);
+
+                    ++m_blockedWorkerCount;
+                    if((m_readyStrandCount > m_idleWorkerCount) && (m_workerCount - m_blockedWorkerCount < m_workerCountMax))
+                    {
+                        startWorker();
+                        m_cvWakeup.notify_one();
+                    }
+                    return true;
+                }
+                //-----------------------------------------------------------------------------
+                //! Ends the blocking of the calling worker started by a successful call to beginBlocking.
+                auto endBlocking()
+                -> void
+                {
+                    isCurrentWorkerBlocked() = false;
+
+                    std::lock_guard<std::mutex> lock(m_mtx);
+
+                    --m_blockedWorkerCount;
+                }
+                //-----------------------------------------------------------------------------
+                //! \return The number of workers currently running.
+                auto getWorkerCount() const
+                -> std::size_t
+                {
+                    std::lock_guard<std::mutex> lock(m_mtx);
+
+                    return m_workerCount;
+                }
+                //-----------------------------------------------------------------------------
+                //! \return The time the strands of the given priority have waited for a worker.
+                auto getStartLatency(
+                    queue::Priority const priority) const
+                -> LatencyMetrics
+                {
+                    std::lock_guard<std::mutex> lock(m_mtx);
+
+                    return m_startLatencies[static_cast<std::size_t>(priority)];
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                //! Appends the given strand to the ready strands of the given priority. The mutex has to be locked.
+                auto pushReadyStrand(
+                    Strand & strand,
+                    queue::Priority const priority)
+                -> void
+                {
+                    m_readyStrands[static_cast<std::size_t>(priority)].push_back(ReadyStrand{&strand, std::chrono::steady_clock::now()});
+                    ++m_readyStrandCount;
+                    if((m_readyStrandCount > m_idleWorkerCount) && (m_workerCount - m_blockedWorkerCount < m_workerCountMax))
+                    {
+                        startWorker();
+                    }
+                    m_cvWakeup.notify_one();
+                }
+                //-----------------------------------------------------------------------------
+                //! Removes the given strand from the ready strands of the given priority. The mutex has to be locked.
+                auto eraseReadyStrand(
+                    Strand & strand,
+                    queue::Priority const priority)
+                -> bool
+                {
+                    auto & readyStrands(m_readyStrands[static_cast<std::size_t>(priority)]);
+                    auto const it(
+                        std::find_if(
+                            readyStrands.begin(),
+                            readyStrands.end(),
+                            [&strand](ReadyStrand const & readyStrand){return readyStrand.m_pStrand == &strand;}));
+                    if(it == readyStrands.end())
+                    {
+                        return false;
+                    }
+                    readyStrands.erase(it);
+                    --m_readyStrandCount;
+                    return true;
+                }
+                //-----------------------------------------------------------------------------
+                //! Removes the next strand to execute from the ready strands and records how long it has waited. The mutex has to be locked.
+                //! This is the first strand of the highest priority unless a strand has waited for more than the aging time.
+                //! Then the strand which has waited the longest is picked instead.
+                auto popReadyStrand()
+                -> Strand *
+                {
+                    auto const now(std::chrono::steady_clock::now());
+                    auto const agingTime(now - m_agingTime);
+
+                    std::size_t selectedPriorityIdx(priorityCount);
+                    bool bSelectedAged(false);
+                    for(std::size_t priorityIdx(priorityCount); priorityIdx-- > 0u;)
+                    {
+                        if(m_readyStrands[priorityIdx].empty())
+                        {
+                            continue;
+                        }
+                        auto const readyTime(m_readyStrands[priorityIdx].front().m_readyTime);
+                        if(selectedPriorityIdx == priorityCount)
+                        {
+                            selectedPriorityIdx = priorityIdx;
+                            bSelectedAged = (readyTime < agingTime);
+                        }
+                        else if((readyTime < agingTime) && (!bSelectedAged || (readyTime < m_readyStrands[selectedPriorityIdx].front().m_readyTime)))
+                        {
+                            selectedPriorityIdx = priorityIdx;
+                            bSelectedAged = true;
+                        }
+                    }
+
+                    auto & readyStrands(m_readyStrands[selectedPriorityIdx]);
+                    auto const readyStrand(readyStrands.front());
+                    readyStrands.pop_front();
+                    --m_readyStrandCount;
+                    m_startLatencies[selectedPriorityIdx].record(std::chrono::duration_cast<std::chrono::nanoseconds>(now - readyStrand.m_readyTime));
+                    return readyStrand.m_pStrand;
+                }
+                //-----------------------------------------------------------------------------
+                //! Starts a new worker. The mutex has to be locked.
+                auto startWorker()
+                -> void
+                {
+                    joinExitedWorkers();
+
+                    ++m_workerCount;
+                    // The worker moves its own thread object to the exited workers when it exits. It can not do so before it has been assigned because the mutex is locked.
+                    m_workers.emplace_back();
+                    auto const itWorker(std::prev(m_workers.end()));
+                    *itWorker = std::thread([this, itWorker](){workerFn(itWorker);});
+                }
+                //-----------------------------------------------------------------------------
+                //! Joins the workers which have exited. The mutex has to be locked.
+                auto joinExitedWorkers()
+                -> void
+                {
+                    for(auto & worker : m_exitedWorkers)
+                    {
+                        worker.join();
+                    }
+                    m_exitedWorkers.clear();
+                }
+                //-----------------------------------------------------------------------------
+                //! \return The executor the calling thread is a worker of or nullptr.
+                static auto getCurrentExecutor()
+                -> StrandExecutor * &
+                {
+                    thread_local StrandExecutor * pCurrentExecutor(nullptr);
+                    return pCurrentExecutor;
+                }
+                //-----------------------------------------------------------------------------
+                //! \return If the calling worker is marked as blocked.
+                static auto isCurrentWorkerBlocked()
+                -> bool &
+                {
+                    thread_local bool bBlocked(false);
+                    return bBlocked;
+                }
+                //-----------------------------------------------------------------------------
+                //! The function the workers are executing.
+                auto workerFn(
+                    std::list<std::thread>::iterator itWorker)
+                -> void;
+
+            private:
+                std::size_t const m_workerCountMax;         //!< The maximum number of workers which are not blocked.
+                std::chrono::milliseconds const m_agingTime;    //!< The time a ready strand may wait before it is picked up regardless of its priority.
+                std::mutex mutable m_mtx;
+                std::condition_variable m_cvWakeup;         //!< Signals the idle workers that a strand is ready or the executor shuts down.
+                std::condition_variable m_cvWorkerExit;     //!< Signals the destructor that a worker has exited.
+                std::array<std::deque<ReadyStrand>, priorityCount> m_readyStrands;  //!< The strands waiting for a worker for each priority.
+                std::array<LatencyMetrics, priorityCount> m_startLatencies;         //!< The time the strands of each priority have waited for a worker.
+                std::list<std::thread> m_workers;           //!< The running workers.
+                std::list<std::thread> m_exitedWorkers;     //!< The workers which have exited but have not been joined yet.
+                std::size_t m_workerCount;
+                std::size_t m_idleWorkerCount;
+                std::size_t m_blockedWorkerCount;           //!< The number of workers waiting for other strands between beginBlocking and endBlocking.
+                std::size_t m_readyStrandCount;             //!< The number of strands waiting for a worker over all priorities.
+                bool m_bShutdownFlag;
+            };
+
+            //#############################################################################
+            //! A sequence of tasks executed one after the other in First In First Out (FIFO) order on a StrandExecutor.
+            //!
+            //! The strand does not own a thread.
+            //! It is scheduled on the executor when a task is enqueued while it is idle and it runs on one worker until it is empty again.
+            //! After ALPAKA_CPU_STRAND_BATCH_SIZE tasks it is appended to the ready strands again so that other strands are not starved.
+            class Strand final
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                explicit Strand(
+                    StrandExecutor & executor,
+                    queue::Priority const priority = queue::Priority::Normal) :
+                        m_executor(executor),
+                        m_priority(priority),
+                        m_numActiveTasks(0u),
+                        m_bScheduled(false),
+                        m_bShutdownFlag(false)
+                {}
+                //-----------------------------------------------------------------------------
+                Strand(Strand const &) = delete;
+                //-----------------------------------------------------------------------------
+                Strand(Strand &&) = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(Strand const &) -> Strand & = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(Strand &&) -> Strand & = delete;
+                //-----------------------------------------------------------------------------
+                //! Completes the currently running task normally.
+                //! Signals a std::runtime_error exception to all other tasks.
+                ~Strand()
+                {
+                    std::unique_lock<std::mutex> lock(m_mtx);
+                    m_bShutdownFlag = true;
+                    if(m_bScheduled)
+                    {
+                        lock.unlock();
+                        bool const bUnscheduled(m_executor.unschedule(*this));
+                        lock.lock();
+                        if(bUnscheduled)
+                        {
+                            m_bScheduled = false;
+                        }
+                        else
+                        {
+                            // A worker is executing the strand. It stops after the current task.
+                            m_cvIdle.wait(lock, [this](){return !m_bScheduled;});
+                        }
+                    }
+
+                    // Signal to each incomplete task that it will not complete due to strand destruction.
+                    while(!m_qTasks.empty())
+                    {
+                        auto currentTaskPackage(std::move(m_qTasks.front()));
+                        m_qTasks.pop_front();
+// Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
+#if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
+                        currentTaskPackage->setException(
+                            std::make_exception_ptr(std::runtime_error("Could not perform task before Strand destruction")));
+#endif
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Runs the given function after all tasks enqueued before.
+                //!
+                //! \param task Function object to be called on the executor.
+                //! \return Signals when the task has completed with either success or an exception.
+                //!         Also results in an exception if the strand is destroyed before execution has begun.
+                template<
+                    typename TFnObj>
+                auto enqueueTask(
+                    TFnObj && task)
+                {
+                    // The active task counter is decremented before the promise is set so that the strand is idle as soon as the last future is ready.
+                    auto extendedTask(
+                        [this, boundTask = std::forward<TFnObj>(task)]()
+                        {
+                            return
+                                invokeBothReturnFirst(
+                                    boundTask,
+                                    [this](){--m_numActiveTasks;}
+                                );
+                        });
+
+                    using TaskPackage = TaskPkg<std::promise, decltype(extendedTask)>;
+                    auto pTaskPackage(new TaskPackage(std::move(extendedTask)));
+                    TaskPkgPtr upTaskPackage(pTaskPackage);
+
+                    auto future(pTaskPackage->m_Promise.get_future());
+
+                    pushTask(std::move(upTaskPackage));
+
+                    return future;
+                }
+                //-----------------------------------------------------------------------------
+                //! Runs the given function after all tasks enqueued before without creating a promise.
+                //!
+                //! The notification is counted as completed before it is executed, so the strand is already idle when it signals waiting threads.
+                //! Therefore it must not do any work the strand has to wait for. Exceptions thrown by it are discarded.
+                //! If the strand is destroyed before the notification has been executed, it is executed by the destructor.
+                //!
+                //! \param notification Function object to be called on the executor.
+                template<
+                    typename TFnObj>
+                auto enqueueNotification(
+                    TFnObj && notification)
+                -> void
+                {
+                    auto extendedNotification(
+                        [this, boundNotification = std::forward<TFnObj>(notification)]()
+                        {
+                            --m_numActiveTasks;
+                            boundNotification();
+                        });
+
+                    using TaskPackage = NotificationTaskPkg<decltype(extendedNotification)>;
+                    pushTask(TaskPkgPtr(new TaskPackage(std::move(extendedNotification))));
+                }
+                //-----------------------------------------------------------------------------
+                //! Executes the given function on the calling thread if the strand is idle.
+                //!
+                //! Tasks enqueued while the function is executed are executed afterwards on the executor.
+                //! Exceptions thrown by the function are discarded just like the ones of tasks whose future is not used.
+                //!
+                //! \param task Function object to be called on the calling thread.
+                //! \return If the function has been executed.
+                template<
+                    typename TFnObj>
+                auto tryRunInline(
+                    TFnObj const & task)
+                -> bool
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(m_mtx);
+
+                        // The strand is not scheduled if and only if it has no incomplete tasks.
+                        if(m_bScheduled || m_bShutdownFlag)
+                        {
+                            return false;
+                        }
+                        // Tasks enqueued meanwhile must not schedule the strand.
+                        m_bScheduled = true;
+                        ++m_numActiveTasks;
+                    }
+
+                    try
+                    {
+                        task();
+                    }
+                    catch(...)
+                    {
+                    }
+
+                    bool bSchedule(false);
+                    {
+                        std::lock_guard<std::mutex> lock(m_mtx);
+
+                        --m_numActiveTasks;
+                        if(m_qTasks.empty())
+                        {
+                            m_bScheduled = false;
+                            m_cvIdle.notify_all();
+                        }
+                        else
+                        {
+                            bSchedule = true;
+                        }
+                    }
+                    if(bSchedule)
+                    {
+                        m_executor.schedule(*this);
+                    }
+                    return true;
+                }
+                //-----------------------------------------------------------------------------
+                //! \return The priority of the strand relative to the other strands of the executor.
+                auto getPriority() const
+                -> queue::Priority
+                {
+                    return m_priority;
+                }
+                //-----------------------------------------------------------------------------
+                //! \return If all enqueued tasks have been completed.
+                auto isIdle() const
+                -> bool
+                {
+                    return m_numActiveTasks == 0u;
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Executes the enqueued tasks. Called by the workers of the executor only.
+                auto run()
+                -> void
+                {
+                    std::unique_lock<std::mutex> lock(m_mtx);
+                    for(std::size_t taskCount(0u);; ++taskCount)
+                    {
+                        if(m_bShutdownFlag || m_qTasks.empty())
+                        {
+                            m_bScheduled = false;
+                            // The destructor may destroy the strand as soon as the lock is released.
+                            m_cvIdle.notify_all();
+                            return;
+                        }
+                        if(taskCount == static_cast<std::size_t>(ALPAKA_CPU_STRAND_BATCH_SIZE))
+                        {
+                            lock.unlock();
+                            m_executor.schedule(*this);
+                            return;
+                        }
+
+                        auto currentTaskPackage(std::move(m_qTasks.front()));
+                        m_qTasks.pop_front();
+                        lock.unlock();
+
+                        currentTaskPackage->runTask();
+                        currentTaskPackage.reset();
+
+                        lock.lock();
+                    }
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                //! Appends the task and schedules the strand if it is not already scheduled.
+                auto pushTask(
+                    TaskPkgPtr upTaskPackage)
+                -> void
+                {
+                    bool bSchedule(false);
+                    {
+                        std::lock_guard<std::mutex> lock(m_mtx);
+
+                        ++m_numActiveTasks;
+                        m_qTasks.push_back(std::move(upTaskPackage));
+                        if(!m_bScheduled)
+                        {
+                            m_bScheduled = true;
+                            bSchedule = true;
+                        }
+                    }
+                    if(bSchedule)
+                    {
+                        m_executor.schedule(*this);
+                    }
+                }
+
+                StrandExecutor & m_executor;
+                queue::Priority const m_priority;
+                std::mutex m_mtx;
+                std::condition_variable m_cvIdle;   //!< Signals the destructor that no worker executes the strand anymore.
+                std::deque<TaskPkgPtr> m_qTasks;
+                std::atomic<std::uint32_t> m_numActiveTasks;
+                bool m_bScheduled;                  //!< If the strand is waiting for a worker or executed by one.
+                bool m_bShutdownFlag;
+            };
+
+            //-----------------------------------------------------------------------------
+            inline auto StrandExecutor::schedule(
+                Strand & strand)
+            -> void
+            {
+                std::lock_guard<std::mutex> lock(m_mtx);
+
+                pushReadyStrand(strand, strand.getPriority());
+            }
+            //-----------------------------------------------------------------------------
+            inline auto StrandExecutor::unschedule(
+                Strand & strand)
+            -> bool
+            {
+                std::lock_guard<std::mutex> lock(m_mtx);
+
+                return eraseReadyStrand(strand, strand.getPriority());
+            }
+            //-----------------------------------------------------------------------------
+            inline auto StrandExecutor::workerFn(
+                std::list<std::thread>::iterator itWorker)
+            -> void
+            {
+                getCurrentExecutor() = this;
+
+                std::unique_lock<std::mutex> lock(m_mtx);
+                while(true)
+                {
+                    // Workers started while others were blocked exit once the blocked ones continue.
+                    if(m_workerCount - m_blockedWorkerCount > m_workerCountMax)
+                    {
+                        break;
+                    }
+                    if(m_readyStrandCount != 0u)
+                    {
+                        auto * const pStrand(popReadyStrand());
+                        lock.unlock();
+
+                        pStrand->run();
+
+                        lock.lock();
+                        continue;
+                    }
+                    if(m_bShutdownFlag)
+                    {
+                        break;
+                    }
+
+                    ++m_idleWorkerCount;
+                    bool const bWoken(
+                        m_cvWakeup.wait_for(
+                            lock,
+                            std::chrono::milliseconds(ALPAKA_CPU_STRAND_EXECUTOR_KEEP_ALIVE_MS),
+                            [this](){return m_bShutdownFlag || (m_readyStrandCount != 0u);}));
+                    --m_idleWorkerCount;
+                    if(!bWoken)
+                    {
+                        break;
+                    }
+                }
+
+                --m_workerCount;
+                m_exitedWorkers.splice(m_exitedWorkers.end(), m_workers, itWorker);
+                m_cvWorkerExit.notify_all();
+            }
+        }
+    }
+}
@@ -15,6 +15,9 @@
 #include <alpaka/wait/Traits.hpp>
 
 #include <alpaka/queue/cpu/IGenericThreadsQueue.hpp>
+#include <alpaka/core/ConcurrentExecPool.hpp>
+#include <alpaka/core/LatencyMetrics.hpp>
+#include <alpaka/core/StrandExecutor.hpp>
 #include <alpaka/core/Unused.hpp>
 #include <alpaka/dev/cpu/SysInfo.hpp>
 
@@ -23,12 +26,41 @@
 
 #include <alpaka/queue/QueueGenericThreadsNonBlocking.hpp>
 #include <alpaka/queue/QueueGenericThreadsBlocking.hpp>
+#include <alpaka/queue/QueueGenericThreadsOutOfOrder.hpp>
 
 #include <map>
 #include <mutex>
+#include <condition_variable>
+#include <future>
+#include <thread>
 #include <memory>
 #include <vector>
 #include <algorithm>
+#include <array>
+#include <chrono>
+
+//-----------------------------------------------------------------------------
+//! The initial number of block threads the kernels running concurrently on a CPU device may use before further kernels wait for them to finish.
+//! Kernels waiting for block threads are started in the order of the priority of their queues.
+//! A value of 0 does not limit the number of block threads, so kernels never wait.
+//! The limit can be changed at runtime via DevCpu::setBlockThreadCountMax.
+#ifndef ALPAKA_CPU_DEV_BLOCK_THREAD_COUNT_MAX
+    #define ALPAKA_CPU_DEV_BLOCK_THREAD_COUNT_MAX 0
+#endif
+//-----------------------------------------------------------------------------
+//! The number of idle block thread pools a CPU device keeps for later kernel launches.
+//! Further pools handed back by finished kernels are destroyed, the smallest ones first.
+#ifndef ALPAKA_CPU_DEV_IDLE_BLOCK_THREAD_POOL_COUNT_MAX
+    #define ALPAKA_CPU_DEV_IDLE_BLOCK_THREAD_POOL_COUNT_MAX 2
+#endif
+//-----------------------------------------------------------------------------
+//! If a CPU device starts one idle block thread pool with one thread per hardware thread when it is created.
+//! The first kernel launch then does not pay for the thread creation.
+//! The pool is started once per device, not once per device handle.
+//! A value of 0 defers the thread creation to the first kernel launch.
+#ifndef ALPAKA_CPU_DEV_PREWARM_BLOCK_THREADS
+    #define ALPAKA_CPU_DEV_PREWARM_BLOCK_THREADS 1
+#endif
 
 namespace alpaka
 {
@@ -62,13 +94,43 @@ namespace alpaka
         {
             namespace detail
             {
+                //#############################################################################
+                //! The pool of threads executing the block threads of kernels on the CPU device.
+                //! Idle threads wait on a condition variable so that pools kept alive by the device do not burn CPU time between kernel launches.
+                using BlockThreadPool =
+                    core::detail::ConcurrentExecPool<
+                        std::size_t,
+                        std::thread,            // The concurrent execution type.
+                        std::promise,           // The promise type.
+                        void,                   // The type yielding the current concurrent execution.
+                        std::mutex,             // The mutex type to use. Only required if TisYielding is true.
+                        std::condition_variable,// The condition variable type to use. Only required if TisYielding is true.
+                        false>;                 // If the threads should yield.
+
                 //#############################################################################
                 //! The CPU device implementation.
+                //!
+                //! The state is shared by all handles to the same device, see PltfCpu.
+                //! Apart from the pre-warmed block threads, no threads are started before the first kernel or task is executed.
                 class DevCpuImpl
                 {
+                    //! The number of queue priorities.
+                    static constexpr std::size_t priorityCount = static_cast<std::size_t>(queue::Priority::High) + 1u;
+
                 public:
                     //-----------------------------------------------------------------------------
-                    DevCpuImpl() = default;
+                    DevCpuImpl() :
+                        m_blockThreadCountMax(static_cast<std::size_t>(ALPAKA_CPU_DEV_BLOCK_THREAD_COUNT_MAX)),
+                        m_claimedBlockThreadCount(0u),
+                        m_waitingClaimCounts()
+                    {
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED) && ALPAKA_CPU_DEV_PREWARM_BLOCK_THREADS
+                        // Pre-warm one pool so that the first kernel launch does not pay for thread creation.
+                        m_idleBlockThreadPools.emplace_back(
+                            std::make_unique<BlockThreadPool>(
+                                std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), static_cast<std::size_t>(1u))));
+#endif
+                    }
                     //-----------------------------------------------------------------------------
                     DevCpuImpl(DevCpuImpl const &) = delete;
                     //-----------------------------------------------------------------------------
@@ -117,9 +179,168 @@ namespace alpaka
                         m_queues.push_back(spQueue);
                     }
 
+                    //-----------------------------------------------------------------------------
+                    //! Leases a block thread pool with at least the given number of threads.
+                    //! An idle pool of the device is reused (and grown if required) instead of creating new threads for each kernel launch.
+                    //! The pool is used exclusively by the caller until it is handed back via releaseBlockThreadPool.
+                    //! Concurrently running kernels (e.g. from different queues) therefore never share threads.
+                    //!
+                    //! If the device limits the number of block threads, the caller waits while the threads of the leased pools would exceed the limit or a caller with a higher priority is waiting.
+                    //! A caller is never delayed if no pool is leased, even if it requests more threads.
+                    ALPAKA_FN_HOST auto acquireBlockThreadPool(
+                        std::size_t blockThreadCount,
+                        queue::Priority const priority = queue::Priority::Normal) const
+                    -> std::unique_ptr<BlockThreadPool>
+                    {
+                        auto const priorityIdx(static_cast<std::size_t>(priority));
+                        auto const beginT(std::chrono::steady_clock::now());
+
+                        std::unique_ptr<BlockThreadPool> upPool;
+                        {
+                            std::unique_lock<std::mutex> lk(m_Mutex);
+
+                            ++m_waitingClaimCounts[priorityIdx];
+                            m_cvBlockThreadsReleased.wait(
+                                lk,
+                                [this, blockThreadCount, priorityIdx]()
+                                {
+                                    for(std::size_t higherPriorityIdx(priorityIdx + 1u); higherPriorityIdx < priorityCount; ++higherPriorityIdx)
+                                    {
+                                        if(m_waitingClaimCounts[higherPriorityIdx] != 0u)
+                                        {
+                                            return false;
+                                        }
+                                    }
+                                    return
+                                        (m_blockThreadCountMax == 0u)
+                                        || (m_claimedBlockThreadCount == 0u)
+                                        || (m_claimedBlockThreadCount + blockThreadCount <= m_blockThreadCountMax);
+                                });
+                            --m_waitingClaimCounts[priorityIdx];
+                            m_claimedBlockThreadCount += blockThreadCount;
+                            m_claimLatencies[priorityIdx].record(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - beginT));
+                            // Callers with a lower priority may have waited for this one.
+                            m_cvBlockThreadsReleased.notify_all();
+
+                            if(!m_idleBlockThreadPools.empty())
+                            {
+                                upPool = std::move(m_idleBlockThreadPools.back());
+                                m_idleBlockThreadPools.pop_back();
+                            }
+                        }
+
+                        if(upPool)
+                        {
+                            upPool->reserveConcurrentExecutionCount(blockThreadCount);
+                        }
+                        else
+                        {
+                            upPool = std::make_unique<BlockThreadPool>(blockThreadCount);
+                        }
+                        return upPool;
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    //! Hands a pool leased via acquireBlockThreadPool with the given number of threads back to the device.
+                    //! At most ALPAKA_CPU_DEV_IDLE_BLOCK_THREAD_POOL_COUNT_MAX idle pools are kept, the smallest surplus pool is destroyed.
+                    ALPAKA_FN_HOST auto releaseBlockThreadPool(
+                        std::unique_ptr<BlockThreadPool> upPool,
+                        std::size_t blockThreadCount) const
+                    -> void
+                    {
+                        std::unique_ptr<BlockThreadPool> upSurplusPool;
+                        {
+                            std::lock_guard<std::mutex> lk(m_Mutex);
+
+                            m_idleBlockThreadPools.push_back(std::move(upPool));
+                            if(m_idleBlockThreadPools.size() > static_cast<std::size_t>(ALPAKA_CPU_DEV_IDLE_BLOCK_THREAD_POOL_COUNT_MAX))
+                            {
+                                auto const itSmallestPool(
+                                    std::min_element(
+                                        m_idleBlockThreadPools.begin(),
+                                        m_idleBlockThreadPools.end(),
+                                        [](std::unique_ptr<BlockThreadPool> const & lhs, std::unique_ptr<BlockThreadPool> const & rhs)
+                                        {
+                                            return lhs->getConcurrentExecutionCount() < rhs->getConcurrentExecutionCount();
+                                        }));
+                                upSurplusPool = std::move(*itSmallestPool);
+                                m_idleBlockThreadPools.erase(itSmallestPool);
+                            }
+                            m_claimedBlockThreadCount -= blockThreadCount;
+                            m_cvBlockThreadsReleased.notify_all();
+                        }
+                        // The threads of the surplus pool are joined without blocking the other users of the device.
+                        upSurplusPool.reset();
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Sets the number of threads of the leased pools above which acquireBlockThreadPool waits. 0 does not limit them.
+                    //! Callers already waiting are re-evaluated against the new limit.
+                    ALPAKA_FN_HOST auto setBlockThreadCountMax(
+                        std::size_t const blockThreadCountMax) const
+                    -> void
+                    {
+                        std::lock_guard<std::mutex> lk(m_Mutex);
+
+                        m_blockThreadCountMax = blockThreadCountMax;
+                        m_cvBlockThreadsReleased.notify_all();
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return The number of threads of the leased pools above which acquireBlockThreadPool waits or 0 if unlimited.
+                    ALPAKA_FN_HOST auto getBlockThreadCountMax() const
+                    -> std::size_t
+                    {
+                        std::lock_guard<std::mutex> lk(m_Mutex);
+
+                        return m_blockThreadCountMax;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return The number of callers of the given priority currently waiting in acquireBlockThreadPool.
+                    ALPAKA_FN_HOST auto getWaitingBlockThreadClaimCount(
+                        queue::Priority const priority) const
+                    -> std::size_t
+                    {
+                        std::lock_guard<std::mutex> lk(m_Mutex);
+
+                        return m_waitingClaimCounts[static_cast<std::size_t>(priority)];
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return The number of block thread pools currently not used by any kernel.
+                    ALPAKA_FN_HOST auto getIdleBlockThreadPoolCount() const
+                    -> std::size_t
+                    {
+                        std::lock_guard<std::mutex> lk(m_Mutex);
+
+                        return m_idleBlockThreadPools.size();
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return The time the kernels of the given priority have waited in acquireBlockThreadPool.
+                    ALPAKA_FN_HOST auto getBlockThreadClaimLatency(
+                        queue::Priority const priority) const
+                    -> core::LatencyMetrics
+                    {
+                        std::lock_guard<std::mutex> lk(m_Mutex);
+
+                        return m_claimLatencies[static_cast<std::size_t>(priority)];
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    //! \return The executor shared by all non-blocking queues of the device.
+                    ALPAKA_FN_HOST auto getStrandExecutor() const
+                    -> core::detail::StrandExecutor &
+                    {
+                        return m_strandExecutor;
+                    }
+
                 private:
                     std::mutex mutable m_Mutex;
                     std::vector<std::weak_ptr<queue::cpu::ICpuQueue>> mutable m_queues;
+                    std::vector<std::unique_ptr<BlockThreadPool>> mutable m_idleBlockThreadPools; //!< The block thread pools currently not used by any kernel.
+                    std::size_t mutable m_blockThreadCountMax;                                    //!< The maximum number of threads of the leased pools or 0 if unlimited.
+                    std::condition_variable mutable m_cvBlockThreadsReleased;                     //!< Signals the callers waiting in acquireBlockThreadPool.
+                    std::size_t mutable m_claimedBlockThreadCount;                                //!< The number of threads of the pools currently leased.
+                    std::array<std::size_t, priorityCount> mutable m_waitingClaimCounts;          //!< The number of callers waiting in acquireBlockThreadPool for each priority.
+                    std::array<core::LatencyMetrics, priorityCount> mutable m_claimLatencies;     //!< The time the callers of each priority have waited in acquireBlockThreadPool.
+                    core::detail::StrandExecutor mutable m_strandExecutor;                        //!< Executes the tasks of the non-blocking queues.
                 };
             }
         }
@@ -133,8 +354,9 @@ namespace alpaka
             friend struct pltf::traits::GetDevByIdx<pltf::PltfCpu>;
         protected:
             //-----------------------------------------------------------------------------
-            DevCpu() :
-                m_spDevCpuImpl(std::make_shared<cpu::detail::DevCpuImpl>())
+            explicit DevCpu(
+                std::shared_ptr<cpu::detail::DevCpuImpl> spDevCpuImpl) :
+                    m_spDevCpuImpl(std::move(spDevCpuImpl))
             {}
         public:
             //-----------------------------------------------------------------------------
@@ -146,10 +368,11 @@ namespace alpaka
             //-----------------------------------------------------------------------------
             auto operator=(DevCpu &&) -> DevCpu & = default;
             //-----------------------------------------------------------------------------
-            auto operator==(DevCpu const &) const
+            //! Handles are equal if they refer to the same device and therefore share its queues, pools and executor.
+            auto operator==(DevCpu const & rhs) const
             -> bool
             {
-                return true;
+                return m_spDevCpuImpl == rhs.m_spDevCpuImpl;
             }
             //-----------------------------------------------------------------------------
             auto operator!=(DevCpu const & rhs) const
@@ -175,6 +398,47 @@ namespace alpaka
                 m_spDevCpuImpl->registerQueue(spQueue);
             }
 
+            //-----------------------------------------------------------------------------
+            //! \return The executor shared by all non-blocking queues of this device.
+            ALPAKA_FN_HOST auto getStrandExecutor() const
+            -> core::detail::StrandExecutor &
+            {
+                return m_spDevCpuImpl->getStrandExecutor();
+            }
+            //-----------------------------------------------------------------------------
+            //! \return The time the non-blocking queues of the given priority have waited for a worker when work has been enqueued into them.
+            ALPAKA_FN_HOST auto getQueueStartLatency(
+                queue::Priority const priority) const
+            -> core::LatencyMetrics
+            {
+                return m_spDevCpuImpl->getStrandExecutor().getStartLatency(priority);
+            }
+            //-----------------------------------------------------------------------------
+            //! Limits the number of block threads the kernels running concurrently on this device may use. 0 does not limit them.
+            //! Further kernels wait until enough block threads are free and are started in the order of the priority of their queues.
+            //! The limit is shared by all handles to the device.
+            ALPAKA_FN_HOST auto setBlockThreadCountMax(
+                std::size_t const blockThreadCountMax) const
+            -> void
+            {
+                m_spDevCpuImpl->setBlockThreadCountMax(blockThreadCountMax);
+            }
+            //-----------------------------------------------------------------------------
+            //! \return The number of block threads the kernels running concurrently on this device may use or 0 if unlimited.
+            ALPAKA_FN_HOST auto getBlockThreadCountMax() const
+            -> std::size_t
+            {
+                return m_spDevCpuImpl->getBlockThreadCountMax();
+            }
+            //-----------------------------------------------------------------------------
+            //! \return The time the kernels enqueued into queues of the given priority have waited for their block threads.
+            ALPAKA_FN_HOST auto getBlockThreadClaimLatency(
+                queue::Priority const priority) const
+            -> core::LatencyMetrics
+            {
+                return m_spDevCpuImpl->getBlockThreadClaimLatency(priority);
+            }
+
         public:
             std::shared_ptr<cpu::detail::DevCpuImpl> m_spDevCpuImpl;
         };
@@ -318,7 +582,9 @@ namespace alpaka
     namespace queue
     {
         using QueueCpuNonBlocking = QueueGenericThreadsNonBlocking<dev::DevCpu>;
+        using QueueCpuNonBlockingInline = QueueGenericThreadsNonBlocking<dev::DevCpu, queue::NonBlockingInline>;
         using QueueCpuBlocking = QueueGenericThreadsBlocking<dev::DevCpu>;
+        using QueueCpuOutOfOrder = QueueGenericThreadsOutOfOrder<dev::DevCpu>;
 
         namespace traits
         {
@@ -339,6 +605,15 @@ namespace alpaka
             {
                 using type = queue::QueueCpuNonBlocking;
             };
+
+            template<>
+            struct QueueType<
+                dev::DevCpu,
+                queue::NonBlockingInline
+            >
+            {
+                using type = queue::QueueCpuNonBlockingInline;
+            };
         }
     }
 }
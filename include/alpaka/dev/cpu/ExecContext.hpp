@@ -0,0 +1,84 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/queue/Properties.hpp>
+
+namespace alpaka
+{
+    namespace dev
+    {
+        namespace cpu
+        {
+            namespace detail
+            {
+                class DevCpuImpl;
+
+                //#############################################################################
+                //! The device and the queue priority of the task executed by the calling thread.
+                //!
+                //! The CPU queues set the context while they execute a task.
+                //! Kernels executed by the task lease their block threads from this device with this priority.
+                //! Contexts can be nested, e.g. by a blocking queue used within a task of another queue. The innermost one is current.
+                class ExecContext final
+                {
+                public:
+                    //-----------------------------------------------------------------------------
+                    ExecContext(
+                        DevCpuImpl & devImpl,
+                        queue::Priority const priority) noexcept :
+                            m_devImpl(devImpl),
+                            m_priority(priority),
+                            m_pPrevContext(currentContextPtr())
+                    {
+                        currentContextPtr() = this;
+                    }
+                    //-----------------------------------------------------------------------------
+                    ExecContext(ExecContext const &) = delete;
+                    //-----------------------------------------------------------------------------
+                    ExecContext(ExecContext &&) = delete;
+                    //-----------------------------------------------------------------------------
+                    auto operator=(ExecContext const &) -> ExecContext & = delete;
+                    //-----------------------------------------------------------------------------
+                    auto operator=(ExecContext &&) -> ExecContext & = delete;
+                    //-----------------------------------------------------------------------------
+                    ~ExecContext()
+                    {
+                        currentContextPtr() = m_pPrevContext;
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    //! \return The context of the task executed by the calling thread or nullptr if it does not execute a task of a CPU queue.
+                    static auto getCurrent() noexcept
+                    -> ExecContext const *
+                    {
+                        return currentContextPtr();
+                    }
+
+                public:
+                    DevCpuImpl & m_devImpl;                 //!< The device the task is executed on.
+                    queue::Priority const m_priority;       //!< The priority of the queue executing the task.
+
+                private:
+                    //-----------------------------------------------------------------------------
+                    //! The pointer is constant initialized so accessing it does not require a guard.
+                    static auto currentContextPtr() noexcept
+                    -> ExecContext const * &
+                    {
+                        thread_local ExecContext const * pCurrentContext(nullptr);
+                        return pCurrentContext;
+                    }
+
+                    ExecContext const * const m_pPrevContext;
+                };
+            }
+        }
+    }
+}
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <alpaka/core/Assert.hpp>
+#include <alpaka/core/StrandExecutor.hpp>
 #include <alpaka/core/Unused.hpp>
 #include <alpaka/core/Utility.hpp>
 
@@ -20,14 +21,28 @@
 
 #include <alpaka/queue/QueueGenericThreadsNonBlocking.hpp>
 #include <alpaka/queue/QueueGenericThreadsBlocking.hpp>
+#include <alpaka/queue/QueueGenericThreadsOutOfOrder.hpp>
 
-#include <mutex>
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
-#include <future>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
     #include <iostream>
 #endif
 
+//-----------------------------------------------------------------------------
+//! The number of times a thread waiting for a CPU event checks it before it blocks.
+//! Waiters do not spin if there is only a single hardware thread.
+#ifndef ALPAKA_CPU_EVENT_SPIN_COUNT
+    #define ALPAKA_CPU_EVENT_SPIN_COUNT 64
+#endif
+
 namespace alpaka
 {
     namespace event
@@ -38,6 +53,10 @@ namespace alpaka
             {
                 //#############################################################################
                 //! The CPU device event implementation.
+                //!
+                //! The state is held in atomic counters, so enqueueing, completing and testing the event do not lock.
+                //! Only a thread that has to block for the event locks the mutex, and only then the completing thread notifies it.
+                //! Queues which must not block a worker for the event register a continuation instead, which is called by the completing thread.
                 template<
                     typename TDev>
                 class EventGenericThreadsImpl final : public concepts::Implements<wait::ConceptCurrentThreadWaitFor, EventGenericThreadsImpl<TDev>>
@@ -47,9 +66,10 @@ namespace alpaka
                     EventGenericThreadsImpl(
                         TDev const & dev) noexcept :
                             m_dev(dev),
-                            m_mutex(),
                             m_enqueueCount(0u),
-                            m_LastReadyEnqueueCount(0u)
+                            m_LastReadyEnqueueCount(0u),
+                            m_numWaiters(0u),
+                            m_numContinuations(0u)
                     {}
                     //-----------------------------------------------------------------------------
                     EventGenericThreadsImpl(EventGenericThreadsImpl<TDev> const &) = delete;
@@ -63,34 +83,141 @@ namespace alpaka
                     ~EventGenericThreadsImpl() noexcept = default;
 
                     //-----------------------------------------------------------------------------
-                    auto isReady() noexcept -> bool
+                    //! \return If the event is not waiting within a queue.
+                    auto isReady() const noexcept -> bool
+                    {
+                        // The ready count never exceeds the enqueue count, so loading it first can not see a pending enqueue as ready.
+                        auto const lastReadyEnqueueCount(m_LastReadyEnqueueCount.load());
+                        return (lastReadyEnqueueCount == m_enqueueCount.load());
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    //! \return If the given enqueue operation or a later one has been completed.
+                    auto isReady(std::size_t const & enqueueCount) const noexcept -> bool
+                    {
+                        return (enqueueCount <= m_LastReadyEnqueueCount.load());
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    //! Marks the event as enqueued.
+                    //! \return The enqueue count identifying this enqueue operation.
+                    auto enqueue() noexcept -> std::size_t
                     {
-                        return (m_LastReadyEnqueueCount == m_enqueueCount);
+                        return ++m_enqueueCount;
                     }
 
                     //-----------------------------------------------------------------------------
-                    auto wait(std::size_t const & enqueueCount, std::unique_lock<std::mutex>& lk) const noexcept -> void
+                    //! Marks the given enqueue operation as completed and wakes up the waiting threads.
+                    auto complete(std::size_t const & enqueueCount) -> void
+                    {
+                        // Nothing to do if it has been re-enqueued to a later position in the queue.
+                        if(enqueueCount != m_enqueueCount.load())
+                        {
+                            return;
+                        }
+
+                        // A later enqueue operation into another queue may already have been completed, so the ready count must never decrease.
+                        auto lastReadyEnqueueCount(m_LastReadyEnqueueCount.load());
+                        while((lastReadyEnqueueCount < enqueueCount)
+                            && !m_LastReadyEnqueueCount.compare_exchange_weak(lastReadyEnqueueCount, enqueueCount))
+                        {
+                        }
+
+                        // A waiter increments the waiter count before it checks the ready count under the lock.
+                        // So either it sees the new ready count or it is counted here and waits for the notification.
+                        // The same holds for the continuations.
+                        if((m_numWaiters.load() != 0u) || (m_numContinuations.load() != 0u))
+                        {
+                            std::vector<std::function<void()>> vReadyContinuations;
+                            {
+                                std::lock_guard<std::mutex> lk(m_mutex);
+
+                                auto const itReady(
+                                    std::partition(
+                                        m_vContinuations.begin(),
+                                        m_vContinuations.end(),
+                                        [this](std::pair<std::size_t, std::function<void()>> const & continuation){return !isReady(continuation.first);}));
+                                for(auto it(itReady); it != m_vContinuations.end(); ++it)
+                                {
+                                    vReadyContinuations.push_back(std::move(it->second));
+                                }
+                                m_vContinuations.erase(itReady, m_vContinuations.end());
+                                m_numContinuations -= vReadyContinuations.size();
+                            }
+                            m_cvReady.notify_all();
+
+                            // The continuations may lock their queue, so they are called without holding the mutex.
+                            for(auto const & continuation : vReadyContinuations)
+                            {
+                                continuation();
+                            }
+                        }
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    //! Registers a function that is called by the thread completing the given enqueue operation or a later one.
+                    //! The function must not throw and must not block.
+                    //! \return If the function has been registered. Otherwise the enqueue operation has already been completed and the function is not called.
+                    auto addContinuation(
+                        std::size_t const & enqueueCount,
+                        std::function<void()> continuation)
+                    -> bool
+                    {
+                        ++m_numContinuations;
+                        std::lock_guard<std::mutex> lk(m_mutex);
+
+                        if(isReady(enqueueCount))
+                        {
+                            --m_numContinuations;
+                            return false;
+                        }
+                        m_vContinuations.emplace_back(enqueueCount, std::move(continuation));
+                        return true;
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    //! Waits until the given enqueue operation or a later one has been completed.
+                    auto wait(std::size_t const & enqueueCount) const -> void
                     {
                         ALPAKA_ASSERT(enqueueCount <= m_enqueueCount);
 
-                        while(enqueueCount > m_LastReadyEnqueueCount)
+                        // Short tasks complete while the waiter spins, so it does not have to block.
+                        // With a single hardware thread the completing thread can not run while the waiter spins.
+                        static std::size_t const maxSpinCount(
+                            (std::thread::hardware_concurrency() > 1u) ? static_cast<std::size_t>(ALPAKA_CPU_EVENT_SPIN_COUNT) : 0u);
+                        for(std::size_t spinCount(0u); spinCount < maxSpinCount; ++spinCount)
+                        {
+                            if(isReady(enqueueCount))
+                            {
+                                return;
+                            }
+                            std::this_thread::yield();
+                        }
+
+                        // The event may be completed by a strand which needs a worker of the device executor itself.
+                        core::detail::StrandExecutor::BlockingScope const blocking;
+                        ++m_numWaiters;
                         {
-                            auto future = m_future;
-                            lk.unlock();
-                            future.get();
-                            lk.lock();
+                            std::unique_lock<std::mutex> lk(m_mutex);
+                            m_cvReady.wait(lk, [this, enqueueCount](){return isReady(enqueueCount);});
                         }
+                        --m_numWaiters;
                     }
 
                 public:
-                    TDev const m_dev;                                //!< The device this event is bound to.
+                    TDev const m_dev;                                       //!< The device this event is bound to.
 
-                    std::mutex mutable m_mutex;                             //!< The mutex used to synchronize access to the event.
-                    std::shared_future<void> m_future;                      //!< The future signaling the event completion.
-                    std::size_t m_enqueueCount;                             //!< The number of times this event has been enqueued.
-                    std::size_t m_LastReadyEnqueueCount;                    //!< The time this event has been ready the last time.
+                    std::atomic<std::size_t> m_enqueueCount;                //!< The number of times this event has been enqueued.
+                    std::atomic<std::size_t> m_LastReadyEnqueueCount;       //!< The time this event has been ready the last time.
                                                                             //!< Ready means that the event was not waiting within a queue (not enqueued or already completed).
                                                                             //!< If m_enqueueCount == m_LastReadyEnqueueCount, the event is currently not enqueued
+
+                private:
+                    std::atomic<std::size_t> mutable m_numWaiters;          //!< The number of threads blocking until the event is ready.
+                    std::atomic<std::size_t> m_numContinuations;            //!< The number of continuations registered or being registered.
+                    std::mutex mutable m_mutex;                             //!< The mutex the blocking threads wait on. It also guards the continuations.
+                    std::condition_variable mutable m_cvReady;              //!< Signals the blocking threads that the event has been completed.
+                    std::vector<std::pair<std::size_t, std::function<void()>>> m_vContinuations;   //!< The functions called when the enqueue operation they wait for is completed.
                 };
             }
         }
@@ -177,8 +304,6 @@ namespace alpaka
                     event::EventGenericThreads<TDev> const & event)
                 -> bool
                 {
-                    std::lock_guard<std::mutex> lk(event.m_spEventImpl->m_mutex);
-
                     return event.m_spEventImpl->isReady();
                 }
             };
@@ -211,41 +336,41 @@ namespace alpaka
                     // This is forwarded to the lambda that is enqueued into the queue to ensure that the event implementation is alive as long as it is enqueued.
                     auto spEventImpl(event.m_spEventImpl);
 
-                    // Setting the event state and enqueuing it has to be atomic.
-                    std::lock_guard<std::mutex> lk(spEventImpl->m_mutex);
-
-                    ++spEventImpl->m_enqueueCount;
+                    auto const enqueueCount = spEventImpl->enqueue();
 
 // Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
 #if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
-                    auto const enqueueCount = spEventImpl->m_enqueueCount;
-
-                    // Enqueue a task that only resets the events flag if it is completed.
-                    spEventImpl->m_future = queueImpl.m_workerThread.enqueueTask(
-                        [spEventImpl, enqueueCount]()
-                        {
-                            std::unique_lock<std::mutex> lk2(spEventImpl->m_mutex);
-
-                            // Nothing to do if it has been re-enqueued to a later position in the queue.
-                            if(enqueueCount == spEventImpl->m_enqueueCount)
+                    if(queueImpl.m_bInlineWhenIdle && queueImpl.m_strand.isIdle())
+                    {
+                        // All tasks enqueued before have been completed, so the event can be completed inline.
+                        spEventImpl->complete(enqueueCount);
+                    }
+                    else
+                    {
+                        // Enqueue a notification that only resets the events flag if it is completed.
+                        queueImpl.m_strand.enqueueNotification(
+                            [spEventImpl, enqueueCount]()
                             {
-                                spEventImpl->m_LastReadyEnqueueCount = spEventImpl->m_enqueueCount;
-                            }
-                        });
+                                spEventImpl->complete(enqueueCount);
+                            });
+                    }
+#else
+                    alpaka::ignore_unused(enqueueCount);
 #endif
                 }
             };
             //#############################################################################
             //! The CPU non-blocking device queue enqueue trait specialization.
             template<
-                typename TDev>
+                typename TDev,
+                typename TProperty>
             struct Enqueue<
-                queue::QueueGenericThreadsNonBlocking<TDev>,
+                queue::QueueGenericThreadsNonBlocking<TDev, TProperty>,
                 event::EventGenericThreads<TDev>>
             {
                 //-----------------------------------------------------------------------------
                 ALPAKA_FN_HOST static auto enqueue(
-                    queue::QueueGenericThreadsNonBlocking<TDev> & queue,
+                    queue::QueueGenericThreadsNonBlocking<TDev, TProperty> & queue,
                     event::EventGenericThreads<TDev> & event)
                 -> void
                 {
@@ -270,28 +395,16 @@ namespace alpaka
                 {
                     ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
 
-                    std::promise<void> promise;
-                    {
-                        std::lock_guard<std::mutex> lk(queueImpl.m_mutex);
+                    std::lock_guard<std::mutex> lk(queueImpl.m_mutex);
 
-                        queueImpl.m_bCurrentlyExecutingTask = true;
+                    queueImpl.m_bCurrentlyExecutingTask = true;
 
-                        auto & eventImpl(*event.m_spEventImpl);
+                    auto & eventImpl(*event.m_spEventImpl);
 
-                        {
-                            // Setting the event state and enqueuing it has to be atomic.
-                            std::lock_guard<std::mutex> evLk(eventImpl.m_mutex);
+                    // NOTE: Difference to non-blocking version: directly set the event state instead of enqueuing.
+                    eventImpl.complete(eventImpl.enqueue());
 
-                            ++eventImpl.m_enqueueCount;
-                            // NOTE: Difference to non-blocking version: directly set the event state instead of enqueuing.
-                            eventImpl.m_LastReadyEnqueueCount = eventImpl.m_enqueueCount;
-
-                            eventImpl.m_future = promise.get_future();
-                        }
-
-                        queueImpl.m_bCurrentlyExecutingTask = false;
-                    }
-                    promise.set_value();
+                    queueImpl.m_bCurrentlyExecutingTask = false;
                 }
             };
             //#############################################################################
@@ -310,6 +423,64 @@ namespace alpaka
                 {
                     ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
 
+                    queue::enqueue(*queue.m_spQueueImpl, event);
+                }
+            };
+            //#############################################################################
+            //! The CPU out-of-order device queue enqueue trait specialization.
+            //! The event is signaled after all tasks enqueued before have been completed.
+            template<
+                typename TDev>
+            struct Enqueue<
+                queue::generic::detail::QueueGenericThreadsOutOfOrderImpl<TDev>,
+                event::EventGenericThreads<TDev>>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto enqueue(
+                    queue::generic::detail::QueueGenericThreadsOutOfOrderImpl<TDev> & queueImpl,
+                    event::EventGenericThreads<TDev> & event)
+                -> void
+                {
+#if (BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
+                    alpaka::ignore_unused(queueImpl);
+#endif
+                    ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+
+                    // Copy the shared pointer of the event implementation.
+                    // This is forwarded to the lambda that is enqueued into the queue to ensure that the event implementation is alive as long as it is enqueued.
+                    auto spEventImpl(event.m_spEventImpl);
+
+                    auto const enqueueCount = spEventImpl->enqueue();
+
+// Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
+#if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
+                    // Enqueue a notification that only resets the events flag if it is completed.
+                    queueImpl.enqueueNotification(
+                        [spEventImpl, enqueueCount]()
+                        {
+                            spEventImpl->complete(enqueueCount);
+                        });
+#else
+                    alpaka::ignore_unused(enqueueCount);
+#endif
+                }
+            };
+            //#############################################################################
+            //! The CPU out-of-order device queue enqueue trait specialization.
+            template<
+                typename TDev>
+            struct Enqueue<
+                queue::QueueGenericThreadsOutOfOrder<TDev>,
+                event::EventGenericThreads<TDev>>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto enqueue(
+                    queue::QueueGenericThreadsOutOfOrder<TDev> & queue,
+                    event::EventGenericThreads<TDev> & event)
+                -> void
+                {
+                    ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+
                     queue::enqueue(*queue.m_spQueueImpl, event);
                 }
             };
@@ -379,10 +550,7 @@ namespace alpaka
                     event::generic::detail::EventGenericThreadsImpl<TDev> const & eventImpl)
                 -> void
                 {
-                    std::unique_lock<std::mutex> lk(eventImpl.m_mutex);
-
-                    auto const enqueueCount = eventImpl.m_enqueueCount;
-                    eventImpl.wait(enqueueCount, lk);
+                    eventImpl.wait(eventImpl.m_enqueueCount.load());
                 }
             };
             //#############################################################################
@@ -407,20 +575,17 @@ namespace alpaka
                     // This is forwarded to the lambda that is enqueued into the queue to ensure that the event implementation is alive as long as it is enqueued.
                     auto spEventImpl(event.m_spEventImpl);
 
-                    std::lock_guard<std::mutex> lk(spEventImpl->m_mutex);
-
-                    if(!spEventImpl->isReady())
+                    auto const enqueueCount = spEventImpl->m_enqueueCount.load();
+                    if(!spEventImpl->isReady(enqueueCount))
                     {
 // Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
 #if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
-                        auto const enqueueCount = spEventImpl->m_enqueueCount;
 
                         // Enqueue a task that waits for the given event.
-                        queueImpl.m_workerThread.enqueueTask(
+                        queueImpl.m_strand.enqueueTask(
                             [spEventImpl, enqueueCount]()
                             {
-                                std::unique_lock<std::mutex> lk2(spEventImpl->m_mutex);
-                                spEventImpl->wait(enqueueCount, lk2);
+                                spEventImpl->wait(enqueueCount);
                             });
 #endif
                     }
@@ -429,14 +594,15 @@ namespace alpaka
             //#############################################################################
             //! The CPU non-blocking device queue event wait trait specialization.
             template<
-                typename TDev>
+                typename TDev,
+                typename TProperty>
             struct WaiterWaitFor<
-                queue::QueueGenericThreadsNonBlocking<TDev>,
+                queue::QueueGenericThreadsNonBlocking<TDev, TProperty>,
                 event::EventGenericThreads<TDev>>
             {
                 //-----------------------------------------------------------------------------
                 ALPAKA_FN_HOST static auto waiterWaitFor(
-                    queue::QueueGenericThreadsNonBlocking<TDev> & queue,
+                    queue::QueueGenericThreadsNonBlocking<TDev, TProperty> & queue,
                     event::EventGenericThreads<TDev> const & event)
                 -> void
                 {
@@ -481,6 +647,58 @@ namespace alpaka
                 }
             };
             //#############################################################################
+            //! The CPU out-of-order device queue event wait trait specialization.
+            //!
+            //! All tasks enqueued later wait for the event.
+            template<
+                typename TDev>
+            struct WaiterWaitFor<
+                queue::generic::detail::QueueGenericThreadsOutOfOrderImpl<TDev>,
+                event::EventGenericThreads<TDev>>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto waiterWaitFor(
+#if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
+                    queue::generic::detail::QueueGenericThreadsOutOfOrderImpl<TDev> & queueImpl,
+#else
+                    queue::generic::detail::QueueGenericThreadsOutOfOrderImpl<TDev> &,
+#endif
+                    event::EventGenericThreads<TDev> const & event)
+                -> void
+                {
+                    // Copy the shared pointer of the event implementation.
+                    // This is forwarded to the lambda that is enqueued into the queue to ensure that the event implementation is alive as long as it is enqueued.
+                    auto spEventImpl(event.m_spEventImpl);
+
+                    auto const enqueueCount = spEventImpl->m_enqueueCount.load();
+                    if(!spEventImpl->isReady(enqueueCount))
+                    {
+// Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
+#if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
+                        // The gate is completed by the thread completing the event, so no worker blocks for it.
+                        queueImpl.enqueueEventGate(std::make_pair(std::move(spEventImpl), enqueueCount));
+#endif
+                    }
+                }
+            };
+            //#############################################################################
+            //! The CPU out-of-order device queue event wait trait specialization.
+            template<
+                typename TDev>
+            struct WaiterWaitFor<
+                queue::QueueGenericThreadsOutOfOrder<TDev>,
+                event::EventGenericThreads<TDev>>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto waiterWaitFor(
+                    queue::QueueGenericThreadsOutOfOrder<TDev> & queue,
+                    event::EventGenericThreads<TDev> const & event)
+                -> void
+                {
+                    wait::wait(*queue.m_spQueueImpl, event);
+                }
+            };
+            //#############################################################################
             //! The CPU non-blocking device event wait trait specialization.
             //!
             //! Any future work submitted in any queue of this device will wait for event to complete before beginning execution.
@@ -513,20 +731,44 @@ namespace alpaka
             //! The CPU non-blocking device queue thread wait trait specialization.
             //!
             //! Blocks execution of the calling thread until the queue has finished processing all previously requested tasks (kernels, data copies, ...)
+            template<
+                typename TDev,
+                typename TProperty>
+            struct CurrentThreadWaitFor<
+                queue::QueueGenericThreadsNonBlocking<TDev, TProperty>>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto currentThreadWaitFor(
+                    queue::QueueGenericThreadsNonBlocking<TDev, TProperty> const & queue)
+                -> void
+                {
+                    event::EventGenericThreads<TDev> event(
+                        dev::getDev(queue));
+                    queue::enqueue(
+                        const_cast<queue::QueueGenericThreadsNonBlocking<TDev, TProperty> &>(queue),
+                        event);
+                    wait::wait(
+                        event);
+                }
+            };
+            //#############################################################################
+            //! The CPU out-of-order device queue thread wait trait specialization.
+            //!
+            //! Blocks execution of the calling thread until the queue has finished processing all previously requested tasks (kernels, data copies, ...)
             template<
                 typename TDev>
             struct CurrentThreadWaitFor<
-                queue::QueueGenericThreadsNonBlocking<TDev>>
+                queue::QueueGenericThreadsOutOfOrder<TDev>>
             {
                 //-----------------------------------------------------------------------------
                 ALPAKA_FN_HOST static auto currentThreadWaitFor(
-                    queue::QueueGenericThreadsNonBlocking<TDev> const & queue)
+                    queue::QueueGenericThreadsOutOfOrder<TDev> const & queue)
                 -> void
                 {
                     event::EventGenericThreads<TDev> event(
                         dev::getDev(queue));
                     queue::enqueue(
-                        const_cast<queue::QueueGenericThreadsNonBlocking<TDev> &>(queue),
+                        const_cast<queue::QueueGenericThreadsOutOfOrder<TDev> &>(queue),
                         event);
                     wait::wait(
                         event);
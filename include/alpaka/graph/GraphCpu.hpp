@@ -0,0 +1,470 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/core/BoostPredef.hpp>
+#include <alpaka/core/StrandExecutor.hpp>
+#include <alpaka/dev/DevCpu.hpp>
+#include <alpaka/dev/cpu/ExecContext.hpp>
+#include <alpaka/event/EventCpu.hpp>
+#include <alpaka/queue/Properties.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace alpaka
+{
+    namespace graph
+    {
+        namespace cpu
+        {
+            namespace detail
+            {
+                //#############################################################################
+                //! A position within a lane of a graph: The lane index and the index of the node within the lane.
+                using GraphPosCpu = std::pair<std::size_t, std::size_t>;
+
+                //#############################################################################
+                //! The implementation of the events recorded by a graph.
+                using GraphEventImplCpu = event::generic::detail::EventGenericThreadsImpl<dev::DevCpu>;
+
+                //#############################################################################
+                //! A captured task or a captured event.
+                struct GraphNodeCpu
+                {
+                    std::function<void()> m_task;                       //!< The task to execute. Empty if the node completes an event.
+                    std::shared_ptr<GraphEventImplCpu> m_spEventImpl;   //!< The event completed by this node or nullptr.
+                    std::vector<GraphPosCpu> m_vDependencies;           //!< The nodes of other lanes that have to be completed before the task can be executed.
+                    bool m_bSignal;                                     //!< If nodes of other lanes depend on this node.
+                    std::size_t m_eventIdx;                             //!< The index of the event among the events of the graph.
+                };
+
+                //#############################################################################
+                //! The graph under construction.
+                //!
+                //! Each capture queue appends its tasks to its own lane.
+                //! The tasks of a lane are executed in order, dependencies between lanes are derived from the events enqueued into and waited for by the capture queues.
+                class GraphCaptureCpuImpl final
+                {
+                public:
+                    using EventImpl = GraphEventImplCpu;
+
+                    //#############################################################################
+                    struct Lane
+                    {
+                        std::vector<GraphNodeCpu> m_vNodes;                     //!< The nodes captured in this lane.
+                        std::vector<GraphPosCpu> m_vPendingDependencies;        //!< The dependencies of the next node captured in this lane.
+                        queue::Priority m_priority;                             //!< The priority of the capture queue recording into this lane.
+                    };
+
+                    //-----------------------------------------------------------------------------
+                    explicit GraphCaptureCpuImpl(
+                        dev::DevCpu const & dev) :
+                            m_dev(dev)
+                    {}
+                    //-----------------------------------------------------------------------------
+                    GraphCaptureCpuImpl(GraphCaptureCpuImpl const &) = delete;
+                    //-----------------------------------------------------------------------------
+                    GraphCaptureCpuImpl(GraphCaptureCpuImpl &&) = delete;
+                    //-----------------------------------------------------------------------------
+                    auto operator=(GraphCaptureCpuImpl const &) -> GraphCaptureCpuImpl & = delete;
+                    //-----------------------------------------------------------------------------
+                    auto operator=(GraphCaptureCpuImpl &&) -> GraphCaptureCpuImpl & = delete;
+                    //-----------------------------------------------------------------------------
+                    ~GraphCaptureCpuImpl() = default;
+
+                    //-----------------------------------------------------------------------------
+                    //! \return The index of the new lane.
+                    auto addLane(
+                        queue::Priority const priority)
+                    -> std::size_t
+                    {
+                        std::lock_guard<std::mutex> lk(m_mutex);
+
+                        m_vLanes.push_back(Lane{{}, {}, priority});
+                        return m_vLanes.size() - 1u;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Appends the task to the given lane.
+                    auto addNode(
+                        std::size_t const laneIdx,
+                        std::function<void()> task)
+                    -> void
+                    {
+                        std::lock_guard<std::mutex> lk(m_mutex);
+
+                        auto & lane(m_vLanes[laneIdx]);
+                        lane.m_vNodes.push_back(GraphNodeCpu{std::move(task), nullptr, std::move(lane.m_vPendingDependencies), false, 0u});
+                        lane.m_vPendingDependencies.clear();
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Appends a node completing the event to the given lane.
+                    //! Its position is the one the nodes waiting for the event depend on.
+                    auto recordEvent(
+                        std::size_t const laneIdx,
+                        std::shared_ptr<EventImpl> const & spEventImpl)
+                    -> void
+                    {
+                        std::lock_guard<std::mutex> lk(m_mutex);
+
+                        auto & lane(m_vLanes[laneIdx]);
+                        lane.m_vNodes.push_back(GraphNodeCpu{{}, spEventImpl, std::move(lane.m_vPendingDependencies), false, 0u});
+                        lane.m_vPendingDependencies.clear();
+                        // The map holds the event implementation so that its address can not be reused by another event during the capture.
+                        m_mapEventPositions[spEventImpl] = GraphPosCpu(laneIdx, lane.m_vNodes.size() - 1u);
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Lets the next node of the given lane depend on the position the event has been recorded at.
+                    //! \return If the event has been recorded in this capture.
+                    auto waitForEvent(
+                        std::size_t const laneIdx,
+                        std::shared_ptr<EventImpl> const & spEventImpl)
+                    -> bool
+                    {
+                        std::lock_guard<std::mutex> lk(m_mutex);
+
+                        auto const itEvent(m_mapEventPositions.find(spEventImpl));
+                        if(itEvent == m_mapEventPositions.end())
+                        {
+                            return false;
+                        }
+
+                        m_vLanes[laneIdx].m_vPendingDependencies.push_back(itEvent->second);
+                        return true;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return A copy of the lanes captured so far.
+                    auto getLanes() const
+                    -> std::vector<Lane>
+                    {
+                        std::lock_guard<std::mutex> lk(m_mutex);
+
+                        return m_vLanes;
+                    }
+
+                public:
+                    dev::DevCpu const m_dev;                    //!< The device the graph is captured for.
+
+                private:
+                    std::mutex mutable m_mutex;
+                    std::vector<Lane> m_vLanes;
+                    std::map<std::shared_ptr<EventImpl>, GraphPosCpu> m_mapEventPositions;         //!< The position of the node completing each event recorded last.
+                };
+
+                //#############################################################################
+                //! The immutable executable graph.
+                //!
+                //! The first lane is executed on the thread replaying the graph, all other lanes are executed on strands of the device executor.
+                //! The strands and the kernels of a lane have the priority of the capture queue the lane has been recorded by.
+                class GraphCpuImpl final
+                {
+                    //#############################################################################
+                    //! The state of a single replay.
+                    struct Replay
+                    {
+                        //-----------------------------------------------------------------------------
+                        explicit Replay(
+                            std::size_t const laneCount) :
+                                m_vLaneProgress(laneCount, 0u),
+                                m_finishedLaneCount(0u)
+                        {}
+
+                        std::mutex m_mutex;
+                        std::condition_variable m_cv;
+                        std::vector<std::size_t> m_vLaneProgress;       //!< The number of nodes of each lane that are known to be completed.
+                        std::size_t m_finishedLaneCount;
+                        std::vector<std::size_t> m_vEventEnqueueCounts; //!< The enqueue operation of each event of the graph this replay completes.
+#if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
+                        std::exception_ptr m_exception;                 //!< The first exception thrown by a node.
+#endif
+                    };
+
+                public:
+                    //-----------------------------------------------------------------------------
+                    explicit GraphCpuImpl(
+                        GraphCaptureCpuImpl const & captureImpl) :
+                            m_dev(captureImpl.m_dev)
+                    {
+                        auto vCapturedLanes(captureImpl.getLanes());
+
+                        // Drop the empty lanes. They can not be the target of a dependency.
+                        std::vector<std::size_t> vLaneIdxMap(vCapturedLanes.size(), 0u);
+                        for(std::size_t laneIdx(0u); laneIdx < vCapturedLanes.size(); ++laneIdx)
+                        {
+                            vLaneIdxMap[laneIdx] = m_vvLanes.size();
+                            if(!vCapturedLanes[laneIdx].m_vNodes.empty())
+                            {
+                                m_vvLanes.push_back(std::move(vCapturedLanes[laneIdx].m_vNodes));
+                                m_vLanePriorities.push_back(vCapturedLanes[laneIdx].m_priority);
+                            }
+                        }
+
+                        // Only keep the dependencies that are not already implied by the lane order or by an earlier dependency of the same lane.
+                        for(std::size_t laneIdx(0u); laneIdx < m_vvLanes.size(); ++laneIdx)
+                        {
+                            // The number of nodes of each other lane this lane already waits for.
+                            std::vector<std::size_t> vAwaitedNodeCounts(m_vvLanes.size(), 0u);
+                            for(auto & node : m_vvLanes[laneIdx])
+                            {
+                                std::vector<GraphPosCpu> vDependencies;
+                                for(auto const & dependency : node.m_vDependencies)
+                                {
+                                    auto const dependencyLaneIdx(vLaneIdxMap[dependency.first]);
+                                    if(dependencyLaneIdx != laneIdx && vAwaitedNodeCounts[dependencyLaneIdx] <= dependency.second)
+                                    {
+                                        vAwaitedNodeCounts[dependencyLaneIdx] = dependency.second + 1u;
+                                        vDependencies.emplace_back(dependencyLaneIdx, dependency.second);
+                                    }
+                                }
+                                node.m_vDependencies = std::move(vDependencies);
+                            }
+                        }
+                        for(auto & vNodes : m_vvLanes)
+                        {
+                            for(auto & node : vNodes)
+                            {
+                                for(auto const & dependency : node.m_vDependencies)
+                                {
+                                    m_vvLanes[dependency.first][dependency.second].m_bSignal = true;
+                                }
+                                if(node.m_spEventImpl)
+                                {
+                                    node.m_eventIdx = m_vspEventImpls.size();
+                                    m_vspEventImpls.push_back(node.m_spEventImpl);
+                                }
+                            }
+                        }
+
+                        for(std::size_t laneIdx(1u); laneIdx < m_vvLanes.size(); ++laneIdx)
+                        {
+                            m_vupStrands.emplace_back(std::make_unique<core::detail::Strand>(m_dev.getStrandExecutor(), m_vLanePriorities[laneIdx]));
+                        }
+                    }
+                    //-----------------------------------------------------------------------------
+                    GraphCpuImpl(GraphCpuImpl const &) = delete;
+                    //-----------------------------------------------------------------------------
+                    GraphCpuImpl(GraphCpuImpl &&) = delete;
+                    //-----------------------------------------------------------------------------
+                    auto operator=(GraphCpuImpl const &) -> GraphCpuImpl & = delete;
+                    //-----------------------------------------------------------------------------
+                    auto operator=(GraphCpuImpl &&) -> GraphCpuImpl & = delete;
+                    //-----------------------------------------------------------------------------
+                    ~GraphCpuImpl() = default;
+
+                    //-----------------------------------------------------------------------------
+                    //! Executes all nodes and returns after all of them have been completed.
+                    //! The recorded events are enqueued when the replay starts and completed when their lane reaches them, like events enqueued into a queue.
+                    //! If nodes throw, all other nodes are still executed and the first exception is rethrown.
+                    //! When replayed on a worker of the device executor, the worker is marked as blocked so the other lanes do not wait for it.
+                    auto replay()
+                    -> void
+                    {
+                        if(m_vvLanes.empty())
+                        {
+                            return;
+                        }
+
+                        auto & executor(m_dev.getStrandExecutor());
+                        bool const bBlocking((m_vvLanes.size() > 1u) && executor.beginBlocking());
+
+                        auto spReplay(std::make_shared<Replay>(m_vvLanes.size()));
+                        spReplay->m_vEventEnqueueCounts.reserve(m_vspEventImpls.size());
+                        for(auto const & spEventImpl : m_vspEventImpls)
+                        {
+                            spReplay->m_vEventEnqueueCounts.push_back(spEventImpl->enqueue());
+                        }
+                        for(std::size_t laneIdx(1u); laneIdx < m_vvLanes.size(); ++laneIdx)
+                        {
+                            // This graph is alive until the replay returns which is after all lanes have been finished.
+                            m_vupStrands[laneIdx - 1u]->enqueueTask(
+                                [this, spReplay, laneIdx]()
+                                {
+                                    executeLane(*spReplay, laneIdx);
+                                });
+                        }
+                        executeLane(*spReplay, 0u);
+
+                        std::unique_lock<std::mutex> lk(spReplay->m_mutex);
+                        spReplay->m_cv.wait(lk, [&spReplay](){return spReplay->m_finishedLaneCount == spReplay->m_vLaneProgress.size();});
+                        lk.unlock();
+                        if(bBlocking)
+                        {
+                            executor.endBlocking();
+                        }
+#if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
+                        if(spReplay->m_exception)
+                        {
+                            std::rethrow_exception(spReplay->m_exception);
+                        }
+#endif
+                    }
+
+                private:
+                    //-----------------------------------------------------------------------------
+                    auto executeLane(
+                        Replay & replay,
+                        std::size_t const laneIdx) const
+                    -> void
+                    {
+                        // The kernels of the lane lease their block threads with the priority of its capture queue.
+                        dev::cpu::detail::ExecContext const context(*m_dev.m_spDevCpuImpl, m_vLanePriorities[laneIdx]);
+
+                        auto const & vNodes(m_vvLanes[laneIdx]);
+                        for(std::size_t nodeIdx(0u); nodeIdx < vNodes.size(); ++nodeIdx)
+                        {
+                            auto const & node(vNodes[nodeIdx]);
+                            if(!node.m_vDependencies.empty())
+                            {
+                                auto const isReady(
+                                    [&replay, &node]()
+                                    {
+                                        return
+                                            std::all_of(
+                                                node.m_vDependencies.begin(),
+                                                node.m_vDependencies.end(),
+                                                [&replay](GraphPosCpu const & dependency){return replay.m_vLaneProgress[dependency.first] > dependency.second;});
+                                    });
+                                std::unique_lock<std::mutex> lk(replay.m_mutex);
+                                if(!isReady())
+                                {
+                                    // The lanes this lane waits for may still wait for a worker.
+                                    core::detail::StrandExecutor::BlockingScope const blocking;
+                                    replay.m_cv.wait(lk, isReady);
+                                }
+                            }
+
+                            if(node.m_spEventImpl)
+                            {
+                                node.m_spEventImpl->complete(replay.m_vEventEnqueueCounts[node.m_eventIdx]);
+                            }
+                            else
+                            {
+// Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
+#if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
+                                try
+                                {
+                                    node.m_task();
+                                }
+                                catch(...)
+                                {
+                                    std::lock_guard<std::mutex> lk(replay.m_mutex);
+                                    if(!replay.m_exception)
+                                    {
+                                        replay.m_exception = std::current_exception();
+                                    }
+                                }
+#else
+                                node.m_task();
+#endif
+                            }
+
+                            // Only the nodes other lanes wait for have to publish the progress.
+                            if(node.m_bSignal)
+                            {
+                                {
+                                    std::lock_guard<std::mutex> lk(replay.m_mutex);
+                                    replay.m_vLaneProgress[laneIdx] = nodeIdx + 1u;
+                                }
+                                replay.m_cv.notify_all();
+                            }
+                        }
+
+                        {
+                            std::lock_guard<std::mutex> lk(replay.m_mutex);
+                            ++replay.m_finishedLaneCount;
+                        }
+                        replay.m_cv.notify_all();
+                    }
+
+                private:
+                    dev::DevCpu const m_dev;                                                //!< Keeps the executor of the strands alive.
+                    std::vector<std::vector<GraphNodeCpu>> m_vvLanes;
+                    std::vector<queue::Priority> m_vLanePriorities;                         //!< The priorities of the capture queues the lanes have been recorded by.
+                    std::vector<std::shared_ptr<GraphEventImplCpu>> m_vspEventImpls;        //!< The events completed by the nodes of the graph.
+                    std::vector<std::unique_ptr<core::detail::Strand>> m_vupStrands;       //!< The strands executing the lanes except the first one.
+                };
+            }
+        }
+
+        //#############################################################################
+        //! Records the tasks enqueued into capture queues created from it.
+        //!
+        //! Tasks are not executed during the capture.
+        //! The captured tasks are copied and executed each time the graph instantiated from this capture is replayed.
+        class GraphCaptureCpu final
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            explicit GraphCaptureCpu(
+                dev::DevCpu const & dev) :
+                    m_spCaptureImpl(std::make_shared<cpu::detail::GraphCaptureCpuImpl>(dev))
+            {}
+            //-----------------------------------------------------------------------------
+            GraphCaptureCpu(GraphCaptureCpu const &) = default;
+            //-----------------------------------------------------------------------------
+            GraphCaptureCpu(GraphCaptureCpu &&) = default;
+            //-----------------------------------------------------------------------------
+            auto operator=(GraphCaptureCpu const &) -> GraphCaptureCpu & = default;
+            //-----------------------------------------------------------------------------
+            auto operator=(GraphCaptureCpu &&) -> GraphCaptureCpu & = default;
+            //-----------------------------------------------------------------------------
+            ~GraphCaptureCpu() = default;
+
+        public:
+            std::shared_ptr<cpu::detail::GraphCaptureCpuImpl> m_spCaptureImpl;
+        };
+
+        //#############################################################################
+        //! The immutable graph instantiated from a capture.
+        //!
+        //! The graph is a task itself: Enqueueing it into a CPU queue replays all captured tasks with a single submission.
+        //! The dependencies between the captured queues are resolved once during the instantiation.
+        //! Events enqueued into capture queues order the nodes of the graph. Each replay enqueues them again and completes them when their lane reaches them.
+        class GraphCpu final
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            //! Instantiates the tasks captured so far.
+            explicit GraphCpu(
+                GraphCaptureCpu const & capture) :
+                    m_spGraphImpl(std::make_shared<cpu::detail::GraphCpuImpl>(*capture.m_spCaptureImpl))
+            {}
+            //-----------------------------------------------------------------------------
+            GraphCpu(GraphCpu const &) = default;
+            //-----------------------------------------------------------------------------
+            GraphCpu(GraphCpu &&) = default;
+            //-----------------------------------------------------------------------------
+            auto operator=(GraphCpu const &) -> GraphCpu & = default;
+            //-----------------------------------------------------------------------------
+            auto operator=(GraphCpu &&) -> GraphCpu & = default;
+            //-----------------------------------------------------------------------------
+            ~GraphCpu() = default;
+
+            //-----------------------------------------------------------------------------
+            //! Replays the graph on the calling thread and the strands of the device.
+            auto operator()() const
+            -> void
+            {
+                m_spGraphImpl->replay();
+            }
+
+        public:
+            std::shared_ptr<cpu::detail::GraphCpuImpl> m_spGraphImpl;
+        };
+    }
+}
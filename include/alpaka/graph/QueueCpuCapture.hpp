@@ -0,0 +1,215 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/dev/Traits.hpp>
+#include <alpaka/event/Traits.hpp>
+#include <alpaka/queue/Traits.hpp>
+#include <alpaka/wait/Traits.hpp>
+
+#include <alpaka/dev/DevCpu.hpp>
+#include <alpaka/event/EventCpu.hpp>
+#include <alpaka/graph/GraphCpu.hpp>
+#include <alpaka/queue/Properties.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace alpaka
+{
+    namespace graph
+    {
+        //#############################################################################
+        //! A queue recording the tasks enqueued into it into a graph capture instead of executing them.
+        //!
+        //! Each capture queue is a lane of the graph. Its tasks are replayed in the order they have been enqueued.
+        //! Waiting for an event enqueued into another capture queue of the same capture makes the following tasks depend on the tasks preceding the event.
+        //! Events enqueued into a capture queue are completed at their position each time the graph is replayed, so they can also be waited for outside of the graph.
+        //! Waiting for any other event makes the following tasks wait for the event each time the graph is replayed.
+        class QueueCpuCapture final
+            : public concepts::Implements<queue::ConceptQueue, QueueCpuCapture>
+            , public concepts::Implements<dev::ConceptGetDev, QueueCpuCapture>
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            //! \param priority The priority the lane of this queue and its kernels are executed with during a replay.
+            explicit QueueCpuCapture(
+                GraphCaptureCpu const & capture,
+                queue::Priority const priority = queue::Priority::Normal) :
+                    m_spCaptureImpl(capture.m_spCaptureImpl),
+                    m_laneIdx(m_spCaptureImpl->addLane(priority)),
+                    m_priority(priority)
+            {}
+            //-----------------------------------------------------------------------------
+            QueueCpuCapture(QueueCpuCapture const &) = default;
+            //-----------------------------------------------------------------------------
+            QueueCpuCapture(QueueCpuCapture &&) = default;
+            //-----------------------------------------------------------------------------
+            auto operator=(QueueCpuCapture const &) -> QueueCpuCapture & = default;
+            //-----------------------------------------------------------------------------
+            auto operator=(QueueCpuCapture &&) -> QueueCpuCapture & = default;
+            //-----------------------------------------------------------------------------
+            auto operator==(QueueCpuCapture const & rhs) const
+            -> bool
+            {
+                return (m_spCaptureImpl == rhs.m_spCaptureImpl) && (m_laneIdx == rhs.m_laneIdx);
+            }
+            //-----------------------------------------------------------------------------
+            auto operator!=(QueueCpuCapture const & rhs) const
+            -> bool
+            {
+                return !((*this) == rhs);
+            }
+            //-----------------------------------------------------------------------------
+            ~QueueCpuCapture() = default;
+
+        public:
+            std::shared_ptr<cpu::detail::GraphCaptureCpuImpl> m_spCaptureImpl;
+            std::size_t m_laneIdx;                                              //!< The lane of the graph this queue records into.
+            queue::Priority m_priority;                                         //!< The priority the lane and its kernels are replayed with.
+        };
+    }
+
+    namespace dev
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU capture queue device type trait specialization.
+            template<>
+            struct DevType<
+                graph::QueueCpuCapture>
+            {
+                using type = dev::DevCpu;
+            };
+            //#############################################################################
+            //! The CPU capture queue device get trait specialization.
+            template<>
+            struct GetDev<
+                graph::QueueCpuCapture>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto getDev(
+                    graph::QueueCpuCapture const & queue)
+                -> dev::DevCpu
+                {
+                    return queue.m_spCaptureImpl->m_dev;
+                }
+            };
+        }
+    }
+    namespace event
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU capture queue event type trait specialization.
+            template<>
+            struct EventType<
+                graph::QueueCpuCapture>
+            {
+                using type = event::EventCpu;
+            };
+        }
+    }
+    namespace queue
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU capture queue enqueue trait specialization.
+            //! This default implementation for all tasks records a copy of the task.
+            template<
+                typename TTask>
+            struct Enqueue<
+                graph::QueueCpuCapture,
+                TTask>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto enqueue(
+                    graph::QueueCpuCapture & queue,
+                    TTask const & task)
+                -> void
+                {
+                    queue.m_spCaptureImpl->addNode(
+                        queue.m_laneIdx,
+                        [task]()
+                        {
+                            task();
+                        });
+                }
+            };
+            //#############################################################################
+            //! The CPU capture queue event enqueue trait specialization.
+            //! The event is not signaled during the capture. Each replay of the graph enqueues it again and completes it at the recorded position.
+            template<>
+            struct Enqueue<
+                graph::QueueCpuCapture,
+                event::EventCpu>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto enqueue(
+                    graph::QueueCpuCapture & queue,
+                    event::EventCpu & event)
+                -> void
+                {
+                    queue.m_spCaptureImpl->recordEvent(queue.m_laneIdx, event.m_spEventImpl);
+                }
+            };
+            //#############################################################################
+            //! The CPU capture queue test trait specialization.
+            //! Nothing is executed within a capture queue.
+            template<>
+            struct Empty<
+                graph::QueueCpuCapture>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto empty(
+                    graph::QueueCpuCapture const &)
+                -> bool
+                {
+                    return true;
+                }
+            };
+        }
+    }
+    namespace wait
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU capture queue event wait trait specialization.
+            template<>
+            struct WaiterWaitFor<
+                graph::QueueCpuCapture,
+                event::EventCpu>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto waiterWaitFor(
+                    graph::QueueCpuCapture & queue,
+                    event::EventCpu const & event)
+                -> void
+                {
+                    if(!queue.m_spCaptureImpl->waitForEvent(queue.m_laneIdx, event.m_spEventImpl))
+                    {
+                        // The event is signaled outside of the graph so wait for it during the replay.
+                        auto spEventImpl(event.m_spEventImpl);
+                        queue.m_spCaptureImpl->addNode(
+                            queue.m_laneIdx,
+                            [spEventImpl]()
+                            {
+                                wait::wait(*spEventImpl);
+                            });
+                    }
+                }
+            };
+        }
+    }
+}
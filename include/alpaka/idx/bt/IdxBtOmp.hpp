@@ -49,6 +49,14 @@ namespace alpaka
                 ALPAKA_FN_HOST auto operator=(IdxBtOmp &&) -> IdxBtOmp & = delete;
                 //-----------------------------------------------------------------------------
                 /*virtual*/ ~IdxBtOmp() = default;
+
+                //-----------------------------------------------------------------------------
+                //! \return If the calling thread executes the first thread of its block.
+                ALPAKA_FN_HOST auto isMasterThread() const
+                -> bool
+                {
+                    return ::omp_get_thread_num() == 0;
+                }
             };
         }
     }
@@ -0,0 +1,135 @@
+/* Copyright 2019 Axel Huebl, Benjamin Worpitz, Matthias Werner
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED) || defined(ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLED)
+
+#include <alpaka/idx/Traits.hpp>
+#include <alpaka/workdiv/Traits.hpp>
+
+#include <alpaka/core/Concepts.hpp>
+#include <alpaka/core/Positioning.hpp>
+#include <alpaka/idx/MapIdx.hpp>
+#include <alpaka/vec/Vec.hpp>
+
+namespace alpaka
+{
+    namespace idx
+    {
+        namespace bt
+        {
+            //#############################################################################
+            //! The fibers and lanes accelerator index provider.
+            //!
+            //! All fibers of a block run on the same thread and only one of them is active at a time.
+            //! The same holds for the block threads of the lane scheduler.
+            //! The index is therefore derived from the linear index of the active fiber instead of being looked up by fiber id.
+            template<
+                typename TDim,
+                typename TIdx>
+            class IdxBtRefActiveFiber : public concepts::Implements<ConceptIdxBt, IdxBtRefActiveFiber<TDim, TIdx>>
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST IdxBtRefActiveFiber(
+                    TIdx const & activeFiberIdx) :
+                    m_activeFiberIdx(activeFiberIdx)
+                {}
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST IdxBtRefActiveFiber(IdxBtRefActiveFiber const &) = delete;
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST IdxBtRefActiveFiber(IdxBtRefActiveFiber &&) = delete;
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator=(IdxBtRefActiveFiber const &) -> IdxBtRefActiveFiber & = delete;
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator=(IdxBtRefActiveFiber &&) -> IdxBtRefActiveFiber & = delete;
+                //-----------------------------------------------------------------------------
+                /*virtual*/ ~IdxBtRefActiveFiber() = default;
+
+                //-----------------------------------------------------------------------------
+                //! \return If the active fiber executes the first thread of its block.
+                ALPAKA_FN_HOST auto isMasterThread() const
+                -> bool
+                {
+                    return m_activeFiberIdx == static_cast<TIdx>(0u);
+                }
+
+            public:
+                TIdx const & m_activeFiberIdx; //!< The linear block thread index of the active fiber.
+            };
+        }
+    }
+
+    namespace dim
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU fibers accelerator index dimension get trait specialization.
+            template<
+                typename TDim,
+                typename TIdx>
+            struct DimType<
+                idx::bt::IdxBtRefActiveFiber<TDim, TIdx>>
+            {
+                using type = TDim;
+            };
+        }
+    }
+    namespace idx
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU fibers accelerator block thread index get trait specialization.
+            template<
+                typename TDim,
+                typename TIdx>
+            struct GetIdx<
+                idx::bt::IdxBtRefActiveFiber<TDim, TIdx>,
+                origin::Block,
+                unit::Threads>
+            {
+                //-----------------------------------------------------------------------------
+                //! \return The index of the current fiber in the block.
+                template<
+                    typename TWorkDiv>
+                ALPAKA_FN_HOST static auto getIdx(
+                    idx::bt::IdxBtRefActiveFiber<TDim, TIdx> const & idx,
+                    TWorkDiv const & workDiv)
+                -> vec::Vec<TDim, TIdx>
+                {
+                    return
+                        idx::mapIdx<TDim::value>(
+                            vec::Vec<dim::DimInt<1u>, TIdx>(idx.m_activeFiberIdx),
+                            workdiv::getWorkDiv<Block, Threads>(workDiv));
+                }
+            };
+        }
+    }
+    namespace idx
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU fibers accelerator block thread index idx type trait specialization.
+            template<
+                typename TDim,
+                typename TIdx>
+            struct IdxType<
+                idx::bt::IdxBtRefActiveFiber<TDim, TIdx>>
+            {
+                using type = TIdx;
+            };
+        }
+    }
+}
+
+#endif
@@ -9,18 +9,12 @@
 
 #pragma once
 
-#ifdef ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED
-
-#include <alpaka/idx/Traits.hpp>
+// Deprecated: This header only forwards to the active fiber index provider and will be removed in a future release.
+#pragma message("alpaka/idx/bt/IdxBtRefFiberIdMap.hpp is deprecated, include alpaka/idx/bt/IdxBtRefActiveFiber.hpp instead.")
 
-#include <alpaka/core/Assert.hpp>
-#include <alpaka/core/Concepts.hpp>
-#include <alpaka/core/Fibers.hpp>
-#include <alpaka/core/Positioning.hpp>
-#include <alpaka/core/Unused.hpp>
-#include <alpaka/vec/Vec.hpp>
+#include <alpaka/idx/bt/IdxBtRefActiveFiber.hpp>
 
-#include <map>
+#ifdef ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED
 
 namespace alpaka
 {
@@ -29,99 +23,13 @@ namespace alpaka
         namespace bt
         {
             //#############################################################################
-            //! The fibers accelerator index provider.
-            template<
-                typename TDim,
-                typename TIdx>
-            class IdxBtRefFiberIdMap : public concepts::Implements<ConceptIdxBt, IdxBtRefFiberIdMap<TDim, TIdx>>
-            {
-            public:
-                using FiberIdToIdxMap = std::map<boost::fibers::fiber::id, vec::Vec<TDim, TIdx>>;
-
-                //-----------------------------------------------------------------------------
-                ALPAKA_FN_HOST IdxBtRefFiberIdMap(
-                    FiberIdToIdxMap const & mFibersToIndices) :
-                    m_fibersToIndices(mFibersToIndices)
-                {}
-                //-----------------------------------------------------------------------------
-                ALPAKA_FN_HOST IdxBtRefFiberIdMap(IdxBtRefFiberIdMap const &) = delete;
-                //-----------------------------------------------------------------------------
-                ALPAKA_FN_HOST IdxBtRefFiberIdMap(IdxBtRefFiberIdMap &&) = delete;
-                //-----------------------------------------------------------------------------
-                ALPAKA_FN_HOST auto operator=(IdxBtRefFiberIdMap const &) -> IdxBtRefFiberIdMap & = delete;
-                //-----------------------------------------------------------------------------
-                ALPAKA_FN_HOST auto operator=(IdxBtRefFiberIdMap &&) -> IdxBtRefFiberIdMap & = delete;
-                //-----------------------------------------------------------------------------
-                /*virtual*/ ~IdxBtRefFiberIdMap() = default;
-
-            public:
-                FiberIdToIdxMap const & m_fibersToIndices; //!< The mapping of fiber id's to fiber indices.
-            };
-        }
-    }
-
-    namespace dim
-    {
-        namespace traits
-        {
-            //#############################################################################
-            //! The CPU fibers accelerator index dimension get trait specialization.
-            template<
-                typename TDim,
-                typename TIdx>
-            struct DimType<
-                idx::bt::IdxBtRefFiberIdMap<TDim, TIdx>>
-            {
-                using type = TDim;
-            };
-        }
-    }
-    namespace idx
-    {
-        namespace traits
-        {
-            //#############################################################################
-            //! The CPU fibers accelerator block thread index get trait specialization.
-            template<
-                typename TDim,
-                typename TIdx>
-            struct GetIdx<
-                idx::bt::IdxBtRefFiberIdMap<TDim, TIdx>,
-                origin::Block,
-                unit::Threads>
-            {
-                //-----------------------------------------------------------------------------
-                //! \return The index of the current thread in the block.
-                template<
-                    typename TWorkDiv>
-                ALPAKA_FN_HOST static auto getIdx(
-                    idx::bt::IdxBtRefFiberIdMap<TDim, TIdx> const & idx,
-                    TWorkDiv const & workDiv)
-                -> vec::Vec<TDim, TIdx>
-                {
-                    alpaka::ignore_unused(workDiv);
-                    auto const fiberId(boost::this_fiber::get_id());
-                    auto const fiberEntry(idx.m_fibersToIndices.find(fiberId));
-                    ALPAKA_ASSERT(fiberEntry != idx.m_fibersToIndices.end());
-                    return fiberEntry->second;
-                }
-            };
-        }
-    }
-    namespace idx
-    {
-        namespace traits
-        {
-            //#############################################################################
-            //! The CPU fibers accelerator block thread index idx type trait specialization.
+            //! The former name of the fibers accelerator index provider.
+            //!
+            //! The indices are not looked up in a map of fiber ids any more, so the constructor taking the map is gone.
             template<
                 typename TDim,
                 typename TIdx>
-            struct IdxType<
-                idx::bt::IdxBtRefFiberIdMap<TDim, TIdx>>
-            {
-                using type = TIdx;
-            };
+            using IdxBtRefFiberIdMap [[deprecated("Use alpaka::idx::bt::IdxBtRefActiveFiber instead.")]] = IdxBtRefActiveFiber<TDim, TIdx>;
         }
     }
 }
@@ -0,0 +1,156 @@
+/* Copyright 2019 Axel Huebl, Benjamin Worpitz, Matthias Werner
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#ifdef ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED
+
+#include <alpaka/idx/Traits.hpp>
+
+#include <alpaka/core/Assert.hpp>
+#include <alpaka/core/Concepts.hpp>
+#include <alpaka/core/Positioning.hpp>
+#include <alpaka/core/Unused.hpp>
+#include <alpaka/vec/Vec.hpp>
+
+namespace alpaka
+{
+    namespace idx
+    {
+        namespace bt
+        {
+            //#############################################################################
+            //! The threads accelerator index provider.
+            //!
+            //! Each block thread registers its index in a thread local variable before executing the kernel.
+            //! Looking up the index is a single thread local load instead of a search for the thread id.
+            //! A thread can only execute one block thread at a time so the variable is never shared between blocks.
+            template<
+                typename TDim,
+                typename TIdx>
+            class IdxBtThreadLocal : public concepts::Implements<ConceptIdxBt, IdxBtThreadLocal<TDim, TIdx>>
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                IdxBtThreadLocal() = default;
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST IdxBtThreadLocal(IdxBtThreadLocal const &) = delete;
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST IdxBtThreadLocal(IdxBtThreadLocal &&) = delete;
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator=(IdxBtThreadLocal const &) -> IdxBtThreadLocal & = delete;
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator=(IdxBtThreadLocal &&) -> IdxBtThreadLocal & = delete;
+                //-----------------------------------------------------------------------------
+                /*virtual*/ ~IdxBtThreadLocal() = default;
+
+                //-----------------------------------------------------------------------------
+                //! Sets the index of the block thread executed by the calling thread.
+                //!
+                //! \param pBlockThreadIdx The index. It has to stay alive until it is reset to nullptr.
+                ALPAKA_FN_HOST static auto setBlockThreadIdx(
+                    vec::Vec<TDim, TIdx> const * pBlockThreadIdx)
+                -> void
+                {
+                    blockThreadIdxPtr() = pBlockThreadIdx;
+                }
+                //-----------------------------------------------------------------------------
+                //! \return The index of the block thread executed by the calling thread.
+                ALPAKA_FN_HOST static auto getBlockThreadIdx()
+                -> vec::Vec<TDim, TIdx> const &
+                {
+                    ALPAKA_ASSERT(blockThreadIdxPtr() != nullptr);
+                    return *blockThreadIdxPtr();
+                }
+                //-----------------------------------------------------------------------------
+                //! \return If the calling thread executes the first thread of its block.
+                ALPAKA_FN_HOST auto isMasterThread() const
+                -> bool
+                {
+                    return getBlockThreadIdx().sum() == static_cast<TIdx>(0u);
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                //! The pointer is constant initialized so accessing it does not require a guard.
+                ALPAKA_FN_HOST static auto blockThreadIdxPtr()
+                -> vec::Vec<TDim, TIdx> const * &
+                {
+                    thread_local vec::Vec<TDim, TIdx> const * pBlockThreadIdx(nullptr);
+                    return pBlockThreadIdx;
+                }
+            };
+        }
+    }
+
+    namespace dim
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU threads accelerator index dimension get trait specialization.
+            template<
+                typename TDim,
+                typename TIdx>
+            struct DimType<
+                idx::bt::IdxBtThreadLocal<TDim, TIdx>>
+            {
+                using type = TDim;
+            };
+        }
+    }
+    namespace idx
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU threads accelerator block thread index get trait specialization.
+            template<
+                typename TDim,
+                typename TIdx>
+            struct GetIdx<
+                idx::bt::IdxBtThreadLocal<TDim, TIdx>,
+                origin::Block,
+                unit::Threads>
+            {
+                //-----------------------------------------------------------------------------
+                //! \return The index of the current thread in the block.
+                template<
+                    typename TWorkDiv>
+                ALPAKA_FN_HOST static auto getIdx(
+                    idx::bt::IdxBtThreadLocal<TDim, TIdx> const & idx,
+                    TWorkDiv const & workDiv)
+                -> vec::Vec<TDim, TIdx>
+                {
+                    alpaka::ignore_unused(idx);
+                    alpaka::ignore_unused(workDiv);
+                    return idx::bt::IdxBtThreadLocal<TDim, TIdx>::getBlockThreadIdx();
+                }
+            };
+        }
+    }
+    namespace idx
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU threads accelerator block thread index idx type trait specialization.
+            template<
+                typename TDim,
+                typename TIdx>
+            struct IdxType<
+                idx::bt::IdxBtThreadLocal<TDim, TIdx>>
+            {
+                using type = TIdx;
+            };
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,399 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/kernel/Traits.hpp>
+
+#include <alpaka/core/Common.hpp>
+#include <alpaka/dim/DimIntegralConst.hpp>
+#include <alpaka/idx/MapIdx.hpp>
+#include <alpaka/meta/NdLoop.hpp>
+#include <alpaka/vec/Vec.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+//! The number of grid block index lists the CPU block back-ends keep for each dimension and index type.
+//! Launches with the same grid block extent and traversal order reuse the list instead of computing it again.
+#ifndef ALPAKA_CPU_GRID_BLOCK_TRAVERSAL_CACHE_SIZE
+    #define ALPAKA_CPU_GRID_BLOCK_TRAVERSAL_CACHE_SIZE 8
+#endif
+
+namespace alpaka
+{
+    namespace kernel
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! Maps the position of a grid block in the traversal order of a block schedule to its index.
+            //!
+            //! The row-major order is computed on the fly.
+            //! The indices of all other orders are computed once per grid block extent and traversal order and are shared by the launches using them.
+            template<
+                typename TDim,
+                typename TIdx>
+            class GridBlockTraversal
+            {
+                using Vec = vec::Vec<TDim, TIdx>;
+
+            public:
+                //-----------------------------------------------------------------------------
+                //! \param blockSchedule The block schedule selecting the traversal order.
+                //! \param gridBlockExtent The grid block extent.
+                ALPAKA_FN_HOST GridBlockTraversal(
+                    BlockSchedule const & blockSchedule,
+                    Vec const & gridBlockExtent) :
+                        m_gridBlockExtent(gridBlockExtent)
+                {
+                    if(blockSchedule.m_traversalOrder != BlockTraversalOrder::RowMajor)
+                    {
+                        m_spGridBlockIdxs = getGridBlockIdxs(blockSchedule, gridBlockExtent);
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                //! \return The index of the grid block at the given position of the traversal.
+                ALPAKA_FN_HOST auto getGridBlockIdx(
+                    TIdx const & i) const
+                -> Vec
+                {
+                    if(!m_spGridBlockIdxs)
+                    {
+                        return
+                            idx::mapIdx<TDim::value>(
+                                vec::Vec<dim::DimInt<1u>, TIdx>(i),
+                                m_gridBlockExtent);
+                    }
+                    return (*m_spGridBlockIdxs)[static_cast<std::size_t>(i)];
+                }
+                //-----------------------------------------------------------------------------
+                //! Calls f for the index of each grid block in traversal order.
+                template<
+                    typename TFnObj>
+                ALPAKA_FN_HOST auto forEach(
+                    TFnObj const & f) const
+                -> void
+                {
+                    if(!m_spGridBlockIdxs)
+                    {
+                        meta::ndLoopIncIdx(
+                            m_gridBlockExtent,
+                            f);
+                    }
+                    else
+                    {
+                        for(auto const & gridBlockIdx : *m_spGridBlockIdxs)
+                        {
+                            f(gridBlockIdx);
+                        }
+                    }
+                }
+
+            private:
+                //#############################################################################
+                //! The grid block indices of one grid block extent and traversal order.
+                struct CacheEntry
+                {
+                    BlockTraversalOrder m_traversalOrder;
+                    std::size_t m_tileSize;
+                    Vec m_gridBlockExtent;
+                    std::shared_ptr<std::vector<Vec> const> m_spGridBlockIdxs;
+                };
+
+                //-----------------------------------------------------------------------------
+                //! \return The grid block indices in the traversal order of the given schedule or nullptr for the row-major order.
+                //! The most recently used lists are cached, see ALPAKA_CPU_GRID_BLOCK_TRAVERSAL_CACHE_SIZE.
+                ALPAKA_FN_HOST static auto getGridBlockIdxs(
+                    BlockSchedule const & blockSchedule,
+                    Vec const & gridBlockExtent)
+                -> std::shared_ptr<std::vector<Vec> const>
+                {
+                    std::size_t const tileSize((blockSchedule.m_traversalOrder == BlockTraversalOrder::Tiled) ? ((blockSchedule.m_tileSize != 0u) ? blockSchedule.m_tileSize : 4u) : 0u);
+
+                    static std::mutex cacheMutex;
+                    static std::vector<CacheEntry> cache;
+                    {
+                        std::lock_guard<std::mutex> lock(cacheMutex);
+                        auto const itEntry(
+                            std::find_if(
+                                cache.begin(),
+                                cache.end(),
+                                [&](CacheEntry const & entry)
+                                {
+                                    return (entry.m_traversalOrder == blockSchedule.m_traversalOrder)
+                                        && (entry.m_tileSize == tileSize)
+                                        && (entry.m_gridBlockExtent == gridBlockExtent);
+                                }));
+                        if(itEntry != cache.end())
+                        {
+                            // Move the entry to the back so that the least recently used one is evicted first.
+                            std::rotate(itEntry, itEntry + 1, cache.end());
+                            return cache.back().m_spGridBlockIdxs;
+                        }
+                    }
+
+                    // The list is computed without holding the lock. Concurrent launches may compute the same list twice.
+                    auto upGridBlockIdxs(std::make_unique<std::vector<Vec>>());
+                    switch(blockSchedule.m_traversalOrder)
+                    {
+                    case BlockTraversalOrder::RowMajor:
+                        break;
+                    case BlockTraversalOrder::Tiled:
+                        traverseTiled(gridBlockExtent, static_cast<TIdx>(tileSize), *upGridBlockIdxs);
+                        break;
+                    case BlockTraversalOrder::ZOrder:
+                        traverseZOrder(gridBlockExtent, *upGridBlockIdxs);
+                        break;
+                    case BlockTraversalOrder::Hilbert:
+                        traverseHilbert(gridBlockExtent, *upGridBlockIdxs);
+                        break;
+                    }
+                    // An empty list stands for the row-major order.
+                    std::shared_ptr<std::vector<Vec> const> spGridBlockIdxs;
+                    if(!upGridBlockIdxs->empty())
+                    {
+                        spGridBlockIdxs = std::move(upGridBlockIdxs);
+                    }
+
+                    if(static_cast<std::size_t>(ALPAKA_CPU_GRID_BLOCK_TRAVERSAL_CACHE_SIZE) > 0u)
+                    {
+                        std::lock_guard<std::mutex> lock(cacheMutex);
+                        if(cache.size() >= static_cast<std::size_t>(ALPAKA_CPU_GRID_BLOCK_TRAVERSAL_CACHE_SIZE))
+                        {
+                            cache.erase(cache.begin());
+                        }
+                        cache.push_back(CacheEntry{blockSchedule.m_traversalOrder, tileSize, gridBlockExtent, spGridBlockIdxs});
+                    }
+                    return spGridBlockIdxs;
+                }
+                //-----------------------------------------------------------------------------
+                //! \return If the given index lies within the grid.
+                ALPAKA_FN_HOST static auto isInGrid(
+                    Vec const & gridBlockExtent,
+                    Vec const & gridBlockIdx)
+                -> bool
+                {
+                    for(typename TDim::value_type d(0u); d < TDim::value; ++d)
+                    {
+                        if(gridBlockIdx[d] >= gridBlockExtent[d])
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+                //-----------------------------------------------------------------------------
+                //! \return The number of bits required to represent the indices smaller than the given extent.
+                ALPAKA_FN_HOST static auto getBitCount(
+                    TIdx const & extent)
+                -> std::uint32_t
+                {
+                    std::uint32_t bitCount(0u);
+                    while((static_cast<std::uint64_t>(1u) << bitCount) < static_cast<std::uint64_t>(extent))
+                    {
+                        ++bitCount;
+                    }
+                    return bitCount;
+                }
+                //-----------------------------------------------------------------------------
+                //! Traverses the tiles in row-major order and the blocks within each tile in row-major order.
+                ALPAKA_FN_HOST static auto traverseTiled(
+                    Vec const & gridBlockExtent,
+                    TIdx const & tileSize,
+                    std::vector<Vec> & gridBlockIdxs)
+                -> void
+                {
+                    auto tileGridExtent(Vec::zeros());
+                    for(typename TDim::value_type d(0u); d < TDim::value; ++d)
+                    {
+                        tileGridExtent[d] = static_cast<TIdx>((gridBlockExtent[d] + tileSize - static_cast<TIdx>(1u)) / tileSize);
+                    }
+
+                    gridBlockIdxs.reserve(static_cast<std::size_t>(gridBlockExtent.prod()));
+                    meta::ndLoopIncIdx(
+                        tileGridExtent,
+                        [&](Vec const & tileIdx)
+                        {
+                            // The tiles at the border of the grid are clipped.
+                            auto const tileOrigin(tileIdx * Vec::all(tileSize));
+                            auto tileExtent(Vec::zeros());
+                            for(typename TDim::value_type d(0u); d < TDim::value; ++d)
+                            {
+                                tileExtent[d] = std::min(tileSize, static_cast<TIdx>(gridBlockExtent[d] - tileOrigin[d]));
+                            }
+                            meta::ndLoopIncIdx(
+                                tileExtent,
+                                [&](Vec const & blockIdxInTile)
+                                {
+                                    gridBlockIdxs.push_back(tileOrigin + blockIdxInTile);
+                                });
+                        });
+                }
+                //-----------------------------------------------------------------------------
+                //! Traverses the blocks along the Z-order curve.
+                //! The bits of the curve index are distributed round-robin to the dimensions which still have bits left.
+                //! This bounds the number of curve indices outside of the grid even for elongated grids.
+                ALPAKA_FN_HOST static auto traverseZOrder(
+                    Vec const & gridBlockExtent,
+                    std::vector<Vec> & gridBlockIdxs)
+                -> void
+                {
+                    std::uint32_t bitCounts[TDim::value];
+                    std::uint32_t totalBitCount(0u);
+                    for(typename TDim::value_type d(0u); d < TDim::value; ++d)
+                    {
+                        bitCounts[d] = getBitCount(gridBlockExtent[d]);
+                        totalBitCount += bitCounts[d];
+                    }
+
+                    gridBlockIdxs.reserve(static_cast<std::size_t>(gridBlockExtent.prod()));
+                    for(std::uint64_t curveIdx(0u); curveIdx < (static_cast<std::uint64_t>(1u) << totalBitCount); ++curveIdx)
+                    {
+                        auto gridBlockIdx(Vec::zeros());
+                        auto remainingBits(curveIdx);
+                        for(std::uint32_t bit(0u); bit < totalBitCount; ++bit)
+                        {
+                            // The last dimension is the fastest varying one.
+                            for(typename TDim::value_type d(TDim::value); d-- > 0u;)
+                            {
+                                if(bit < bitCounts[d])
+                                {
+                                    gridBlockIdx[d] = static_cast<TIdx>(gridBlockIdx[d] | static_cast<TIdx>((remainingBits & 1u) << bit));
+                                    remainingBits >>= 1u;
+                                }
+                            }
+                        }
+                        if(isInGrid(gridBlockExtent, gridBlockIdx))
+                        {
+                            gridBlockIdxs.push_back(gridBlockIdx);
+                        }
+                    }
+                }
+                //-----------------------------------------------------------------------------
+                //! Traverses the blocks along the Hilbert curve through the dimensions with an extent larger than one.
+                //! Elongated grids are split into row-major cubes with a power of two edge length not much larger than the smallest of these extents.
+                //! The curve indices are converted to coordinates with the algorithm of J. Skilling, "Programming the Hilbert curve", AIP Conference Proceedings 707, 381 (2004).
+                ALPAKA_FN_HOST static auto traverseHilbert(
+                    Vec const & gridBlockExtent,
+                    std::vector<Vec> & gridBlockIdxs)
+                -> void
+                {
+                    // The dimensions with an extent of one do not contribute to the curve.
+                    typename TDim::value_type curveDims[TDim::value];
+                    typename TDim::value_type curveDimCount(0u);
+                    auto bitCount(std::numeric_limits<std::uint32_t>::max());
+                    for(typename TDim::value_type d(0u); d < TDim::value; ++d)
+                    {
+                        if(gridBlockExtent[d] > static_cast<TIdx>(1u))
+                        {
+                            curveDims[curveDimCount++] = d;
+                            bitCount = std::min(bitCount, getBitCount(gridBlockExtent[d]));
+                        }
+                    }
+                    // A curve through a single dimension is the row-major order.
+                    if(curveDimCount < 2u)
+                    {
+                        return;
+                    }
+
+                    // The offsets of the blocks within a cube in curve order.
+                    std::vector<Vec> cubeBlockOffsets;
+                    cubeBlockOffsets.reserve(static_cast<std::size_t>(1u) << (bitCount * curveDimCount));
+                    std::uint64_t coords[TDim::value];
+                    for(std::uint64_t curveIdx(0u); curveIdx < (static_cast<std::uint64_t>(1u) << (bitCount * curveDimCount)); ++curveIdx)
+                    {
+                        // Transpose the curve index: The most significant bits of the coordinates are taken from the most significant bits of the index.
+                        for(typename TDim::value_type i(0u); i < curveDimCount; ++i)
+                        {
+                            coords[i] = 0u;
+                            for(std::uint32_t bit(0u); bit < bitCount; ++bit)
+                            {
+                                coords[i] |= ((curveIdx >> (bit * curveDimCount + (curveDimCount - 1u - i))) & 1u) << bit;
+                            }
+                        }
+
+                        // Gray decode.
+                        auto const t(coords[curveDimCount - 1u] >> 1u);
+                        for(typename TDim::value_type i(curveDimCount - 1u); i > 0u; --i)
+                        {
+                            coords[i] ^= coords[i - 1u];
+                        }
+                        coords[0] ^= t;
+
+                        // Undo the excess work.
+                        for(std::uint64_t q(2u); q != (static_cast<std::uint64_t>(1u) << bitCount); q <<= 1u)
+                        {
+                            auto const p(q - 1u);
+                            for(typename TDim::value_type i(curveDimCount); i-- > 0u;)
+                            {
+                                if((coords[i] & q) != 0u)
+                                {
+                                    coords[0] ^= p;
+                                }
+                                else
+                                {
+                                    auto const swapBits((coords[0] ^ coords[i]) & p);
+                                    coords[0] ^= swapBits;
+                                    coords[i] ^= swapBits;
+                                }
+                            }
+                        }
+
+                        auto cubeBlockOffset(Vec::zeros());
+                        for(typename TDim::value_type i(0u); i < curveDimCount; ++i)
+                        {
+                            cubeBlockOffset[curveDims[i]] = static_cast<TIdx>(coords[i]);
+                        }
+                        cubeBlockOffsets.push_back(cubeBlockOffset);
+                    }
+
+                    auto const cubeEdge(static_cast<TIdx>(static_cast<std::uint64_t>(1u) << bitCount));
+                    auto cubeGridExtent(Vec::ones());
+                    for(typename TDim::value_type i(0u); i < curveDimCount; ++i)
+                    {
+                        auto const d(curveDims[i]);
+                        cubeGridExtent[d] = static_cast<TIdx>((gridBlockExtent[d] + cubeEdge - static_cast<TIdx>(1u)) / cubeEdge);
+                    }
+
+                    gridBlockIdxs.reserve(static_cast<std::size_t>(gridBlockExtent.prod()));
+                    meta::ndLoopIncIdx(
+                        cubeGridExtent,
+                        [&](Vec const & cubeIdx)
+                        {
+                            auto cubeOrigin(Vec::zeros());
+                            for(typename TDim::value_type i(0u); i < curveDimCount; ++i)
+                            {
+                                cubeOrigin[curveDims[i]] = static_cast<TIdx>(cubeIdx[curveDims[i]] * cubeEdge);
+                            }
+                            for(auto const & cubeBlockOffset : cubeBlockOffsets)
+                            {
+                                auto const gridBlockIdx(cubeOrigin + cubeBlockOffset);
+                                if(isInGrid(gridBlockExtent, gridBlockIdx))
+                                {
+                                    gridBlockIdxs.push_back(gridBlockIdx);
+                                }
+                            }
+                        });
+                }
+
+            private:
+                Vec const m_gridBlockExtent;
+                std::shared_ptr<std::vector<Vec> const> m_spGridBlockIdxs; //!< The grid block indices in traversal order. Null for the row-major order.
+            };
+        }
+    }
+}
@@ -31,8 +31,8 @@
 #include <alpaka/meta/NdLoop.hpp>
 #include <alpaka/meta/ApplyTuple.hpp>
 
-#include <algorithm>
-#include <functional>
+#include <memory>
+#include <utility>
 #include <vector>
 #include <tuple>
 #include <type_traits>
@@ -68,16 +68,47 @@ namespace alpaka
                 }
             };
             //#############################################################################
+            //! A fiber whose stack is taken from a pool owned by the calling thread.
+            //! The pool outlives the kernel so following kernels reuse the stacks instead of allocating new ones for each fiber.
+            class PooledStackFiber :
+                public boost::fibers::fiber
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TFnObj>
+                explicit PooledStackFiber(
+                    TFnObj && fnObj) :
+                        boost::fibers::fiber(std::allocator_arg, getStackPool(), std::forward<TFnObj>(fnObj))
+                {}
+
+            private:
+                //-----------------------------------------------------------------------------
+                //! \return The stack pool of the calling thread.
+                ALPAKA_FN_HOST static auto getStackPool()
+                -> boost::fibers::pooled_fixedsize_stack &
+                {
+                    // Fibers never migrate between threads, so each thread can use its own pool without locking.
+                    thread_local boost::fibers::pooled_fixedsize_stack stackPool;
+                    return stackPool;
+                }
+            };
+            //#############################################################################
             // Yielding is not faster for fibers. Therefore we use condition variables.
             // It is better to wake them up when the conditions are fulfilled because this does not cost as much as for real threads.
             using FiberPool = alpaka::core::detail::ConcurrentExecPool<
                 TIdx,
-                boost::fibers::fiber,               // The concurrent execution type.
+                PooledStackFiber,                   // The concurrent execution type.
                 boost::fibers::promise,             // The promise type.
                 FiberPoolYield,                     // The type yielding the current concurrent execution.
                 boost::fibers::mutex,               // The mutex type to use. Only required if TisYielding is true.
                 boost::fibers::condition_variable,  // The condition variable type to use. Only required if TisYielding is true.
                 false>;                             // If the threads should yield.
+            //#############################################################################
+            //! The latch signaled by the block thread tasks of a block.
+            using Latch = alpaka::core::detail::CompletionLatch<
+                boost::fibers::mutex,
+                boost::fibers::condition_variable>;
 
         public:
             //-----------------------------------------------------------------------------
@@ -151,147 +182,84 @@ namespace alpaka
                 auto const blockThreadCount(blockThreadExtent.prod());
                 FiberPool fiberPool(blockThreadCount);
 
-                auto const boundGridBlockExecHost(
-                    meta::apply(
-                        [this, &acc, &blockThreadExtent, &fiberPool](ALPAKA_DECAY_T(TArgs) const & ... args)
-                        {
-                            // Bind the kernel and its arguments to the grid block function.
-                            return
-                                std::bind(
-                                    &TaskKernelCpuFibers::gridBlockExecHost,
-                                    std::ref(acc),
-                                    std::placeholders::_1,
-                                    std::ref(blockThreadExtent),
-                                    std::ref(fiberPool),
-                                    std::ref(m_kernelFnObj),
-                                    std::ref(args)...);
-                        },
-                        m_args));
+                // Creates the function executed by a single block thread.
+                auto const makeBlockThreadTask(
+                    [this, &acc](
+                        TIdx const & blockThreadIdx)
+                    {
+                        return
+                            [this, &acc, blockThreadIdx]()
+                            {
+                                meta::apply(
+                                    [&](ALPAKA_DECAY_T(TArgs) const & ... args)
+                                    {
+                                        blockThreadFiberFn(
+                                            acc,
+                                            blockThreadIdx,
+                                            m_kernelFnObj,
+                                            args...);
+                                    },
+                                    m_args);
+                            };
+                    });
+                using BlockThreadTask = core::detail::IntrusiveTaskPkg<
+                    Latch,
+                    decltype(makeBlockThreadTask(static_cast<TIdx>(0u)))>;
+
+                // The storage for the tasks of a block is allocated once and reused by all blocks.
+                std::vector<BlockThreadTask> blockThreadTasks;
+                blockThreadTasks.reserve(static_cast<std::size_t>(blockThreadCount));
 
                 // Execute the blocks serially.
                 meta::ndLoopIncIdx(
                     gridBlockExtent,
-                    boundGridBlockExecHost);
-            }
-
-        private:
-            //-----------------------------------------------------------------------------
-            //! The function executed for each grid block.
-            ALPAKA_FN_HOST static auto gridBlockExecHost(
-                acc::AccCpuFibers<TDim, TIdx> & acc,
-                vec::Vec<TDim, TIdx> const & gridBlockIdx,
-                vec::Vec<TDim, TIdx> const & blockThreadExtent,
-                FiberPool & fiberPool,
-                TKernelFnObj const & kernelFnObj,
-                std::decay_t<TArgs> const & ... args)
-            -> void
-            {
-                    // The futures of the threads in the current block.
-                std::vector<boost::fibers::future<void>> futuresInBlock;
-
-                // Set the index of the current block
-                acc.m_gridBlockIdx = gridBlockIdx;
-
-                // Bind the kernel and its arguments to the host block thread execution function.
-                auto boundBlockThreadExecHost(std::bind(
-                    &TaskKernelCpuFibers::blockThreadExecHost,
-                    std::ref(acc),
-                    std::ref(futuresInBlock),
-                    std::placeholders::_1,
-                    std::ref(fiberPool),
-                    std::ref(kernelFnObj),
-                    std::ref(args)...));
-                // Execute the block threads in parallel.
-                meta::ndLoopIncIdx(
-                    blockThreadExtent,
-                    boundBlockThreadExecHost);
-
-                // Wait for the completion of the block thread kernels.
-                std::for_each(
-                    futuresInBlock.begin(),
-                    futuresInBlock.end(),
-                    [](boost::fibers::future<void> & t)
+                    [&](vec::Vec<TDim, TIdx> const & gridBlockIdx)
                     {
-                        t.wait();
-                    }
-                );
-                // Clean up.
-                futuresInBlock.clear();
+                        // Set the index of the current block
+                        acc.m_gridBlockIdx = gridBlockIdx;
 
-                acc.m_fibersToIndices.clear();
-
-                // After a block has been processed, the shared memory has to be deleted.
-                block::shared::st::freeMem(acc);
-            }
-            //-----------------------------------------------------------------------------
-            //! The function executed for each block thread.
-            ALPAKA_FN_HOST static auto blockThreadExecHost(
-                acc::AccCpuFibers<TDim, TIdx> & acc,
+                        // Execute the block threads in parallel.
+                        Latch latch(static_cast<std::size_t>(blockThreadCount));
+                        for(TIdx blockThreadIdx(0u); blockThreadIdx < blockThreadCount; ++blockThreadIdx)
+                        {
+                            blockThreadTasks.emplace_back(
+                                latch,
+                                makeBlockThreadTask(blockThreadIdx));
+// Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
 #if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
-                std::vector<boost::fibers::future<void>> & futuresInBlock,
-                vec::Vec<TDim, TIdx> const & blockThreadIdx,
-                FiberPool & fiberPool,
-#else
-                std::vector<boost::fibers::future<void>> &,
-                vec::Vec<TDim, TIdx> const & blockThreadIdx,
-                FiberPool &,
+                            fiberPool.enqueueIntrusiveTask(blockThreadTasks.back());
 #endif
-                TKernelFnObj const & kernelFnObj,
-                std::decay_t<TArgs> const & ... args)
-            -> void
-            {
-                // Bind the arguments to the accelerator block thread execution function.
-                // The blockThreadIdx is required to be copied in because the variable will get changed for the next iteration/thread.
-                auto boundBlockThreadExecAcc(
-                    [&, blockThreadIdx]()
-                    {
-                        blockThreadFiberFn(
-                            acc,
-                            blockThreadIdx,
-                            kernelFnObj,
-                            args...);
-                    });
-                // Add the bound function to the block thread pool.
+                        }
 // Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
 #if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
-                futuresInBlock.emplace_back(
-                    fiberPool.enqueueTask(
-                        boundBlockThreadExecAcc));
-#else
-                (void)boundBlockThreadExecAcc;
+                        // Wait for the completion of the block thread kernels.
+                        latch.wait();
 #endif
+                        // Clean up.
+                        blockThreadTasks.clear();
+
+                        // After a block has been processed, the shared memory has to be deleted.
+                        block::shared::st::freeMem(acc);
+                    });
             }
+
+        private:
             //-----------------------------------------------------------------------------
             //! The fiber entry point.
             ALPAKA_FN_HOST static auto blockThreadFiberFn(
                 acc::AccCpuFibers<TDim, TIdx> & acc,
-                vec::Vec<TDim, TIdx> const & blockThreadIdx,
+                TIdx const & blockThreadIdx,
                 TKernelFnObj const & kernelFnObj,
                 std::decay_t<TArgs> const & ... args)
             -> void
             {
-                // We have to store the fiber data before the kernel is calling any of the methods of this class depending on them.
-                auto const fiberId(boost::this_fiber::get_id());
-
-                // Set the master thread id.
-                if(blockThreadIdx.sum() == 0)
-                {
-                    acc.m_masterFiberId = fiberId;
-                }
-
-                // Save the fiber id, and index.
-                acc.m_fibersToIndices.emplace(fiberId, blockThreadIdx);
-
-                // Sync all threads so that the maps with thread id's are complete and not changed after here.
-                syncBlockThreads(acc);
+                // Only one fiber of the block runs at a time. It publishes its index until it waits at the next barrier.
+                acc.m_activeFiberIdx = blockThreadIdx;
 
                 // Execute the kernel itself.
                 kernelFnObj(
                     const_cast<acc::AccCpuFibers<TDim, TIdx> const &>(acc),
                     args...);
-
-                // We have to sync all fibers here because if a fiber would finish before all fibers have been started, the new fiber could get a recycled (then duplicate) fiber id!
-                syncBlockThreads(acc);
             }
 
             TKernelFnObj m_kernelFnObj;
@@ -0,0 +1,244 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#ifdef ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLED
+
+// Specialized traits.
+#include <alpaka/acc/Traits.hpp>
+#include <alpaka/dev/Traits.hpp>
+#include <alpaka/dim/Traits.hpp>
+#include <alpaka/pltf/Traits.hpp>
+#include <alpaka/idx/Traits.hpp>
+
+// Implementation details.
+#include <alpaka/acc/AccCpuLanes.hpp>
+#include <alpaka/core/Decay.hpp>
+#include <alpaka/dev/DevCpu.hpp>
+#include <alpaka/kernel/Traits.hpp>
+#include <alpaka/workdiv/WorkDivMembers.hpp>
+
+#include <alpaka/meta/NdLoop.hpp>
+#include <alpaka/meta/ApplyTuple.hpp>
+
+#include <utility>
+#include <tuple>
+#include <type_traits>
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
+    #include <iostream>
+#endif
+
+namespace alpaka
+{
+    namespace kernel
+    {
+        //#############################################################################
+        //! The CPU lanes accelerator execution task.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TKernelFnObj,
+            typename... TArgs>
+        class TaskKernelCpuLanes final :
+            public workdiv::WorkDivMembers<TDim, TIdx>
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            template<
+                typename TWorkDiv>
+            ALPAKA_FN_HOST TaskKernelCpuLanes(
+                TWorkDiv && workDiv,
+                TKernelFnObj const & kernelFnObj,
+                TArgs && ... args) :
+                    workdiv::WorkDivMembers<TDim, TIdx>(std::forward<TWorkDiv>(workDiv)),
+                    m_kernelFnObj(kernelFnObj),
+                    m_args(std::forward<TArgs>(args)...)
+            {
+                static_assert(
+                    dim::Dim<std::decay_t<TWorkDiv>>::value == TDim::value,
+                    "The work division and the execution task have to be of the same dimensionality!");
+            }
+            //-----------------------------------------------------------------------------
+            TaskKernelCpuLanes(TaskKernelCpuLanes const &) = default;
+            //-----------------------------------------------------------------------------
+            TaskKernelCpuLanes(TaskKernelCpuLanes &&) = default;
+            //-----------------------------------------------------------------------------
+            auto operator=(TaskKernelCpuLanes const &) -> TaskKernelCpuLanes & = default;
+            //-----------------------------------------------------------------------------
+            auto operator=(TaskKernelCpuLanes &&) -> TaskKernelCpuLanes & = default;
+            //-----------------------------------------------------------------------------
+            ~TaskKernelCpuLanes() = default;
+
+            //-----------------------------------------------------------------------------
+            //! Executes the kernel function object.
+            ALPAKA_FN_HOST auto operator()() const
+            -> void
+            {
+                ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+
+                auto const gridBlockExtent(
+                    workdiv::getWorkDiv<Grid, Blocks>(*this));
+                auto const blockThreadExtent(
+                    workdiv::getWorkDiv<Block, Threads>(*this));
+                auto const threadElemExtent(
+                    workdiv::getWorkDiv<Thread, Elems>(*this));
+
+                // Get the size of the block shared dynamic memory.
+                auto const blockSharedMemDynSizeBytes(
+                    meta::apply(
+                        [&](ALPAKA_DECAY_T(TArgs) const & ... args)
+                        {
+                            return
+                                kernel::getBlockSharedMemDynSizeBytes<
+                                    acc::AccCpuLanes<TDim, TIdx>>(
+                                        m_kernelFnObj,
+                                        blockThreadExtent,
+                                        threadElemExtent,
+                                        args...);
+                        },
+                        m_args));
+
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
+                std::cout << __func__
+                    << " blockSharedMemDynSizeBytes: " << blockSharedMemDynSizeBytes << " B" << std::endl;
+#endif
+                acc::AccCpuLanes<TDim, TIdx> acc(
+                    *static_cast<workdiv::WorkDivMembers<TDim, TIdx> const *>(this),
+                    blockSharedMemDynSizeBytes);
+
+                auto const blockThreadCount(blockThreadExtent.prod());
+
+                // Execute the blocks serially.
+                meta::ndLoopIncIdx(
+                    gridBlockExtent,
+                    [&](vec::Vec<TDim, TIdx> const & gridBlockIdx)
+                    {
+                        // Set the index of the current block
+                        acc.m_gridBlockIdx = gridBlockIdx;
+
+                        // Execute the block threads interleaved on the current thread.
+                        acc.run(
+                            blockThreadCount,
+                            [&](TIdx const & /*blockThreadIdx*/)
+                            {
+                                meta::apply(
+                                    [&](ALPAKA_DECAY_T(TArgs) const & ... args)
+                                    {
+                                        m_kernelFnObj(
+                                            const_cast<acc::AccCpuLanes<TDim, TIdx> const &>(acc),
+                                            args...);
+                                    },
+                                    m_args);
+                            });
+
+                        // After a block has been processed, the shared memory has to be deleted.
+                        block::shared::st::freeMem(acc);
+                    });
+            }
+
+        private:
+            TKernelFnObj m_kernelFnObj;
+            std::tuple<std::decay_t<TArgs>...> m_args;
+        };
+    }
+
+    namespace acc
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU lanes execution task accelerator type trait specialization.
+            template<
+                typename TDim,
+                typename TIdx,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct AccType<
+                kernel::TaskKernelCpuLanes<TDim, TIdx, TKernelFnObj, TArgs...>>
+            {
+                using type = acc::AccCpuLanes<TDim, TIdx>;
+            };
+        }
+    }
+    namespace dev
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU lanes execution task device type trait specialization.
+            template<
+                typename TDim,
+                typename TIdx,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct DevType<
+                kernel::TaskKernelCpuLanes<TDim, TIdx, TKernelFnObj, TArgs...>>
+            {
+                using type = dev::DevCpu;
+            };
+        }
+    }
+    namespace dim
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU lanes execution task dimension getter trait specialization.
+            template<
+                typename TDim,
+                typename TIdx,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct DimType<
+                kernel::TaskKernelCpuLanes<TDim, TIdx, TKernelFnObj, TArgs...>>
+            {
+                using type = TDim;
+            };
+        }
+    }
+    namespace pltf
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU lanes execution task platform type trait specialization.
+            template<
+                typename TDim,
+                typename TIdx,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct PltfType<
+                kernel::TaskKernelCpuLanes<TDim, TIdx, TKernelFnObj, TArgs...>>
+            {
+                using type = pltf::PltfCpu;
+            };
+        }
+    }
+    namespace idx
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU lanes execution task idx type trait specialization.
+            template<
+                typename TDim,
+                typename TIdx,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct IdxType<
+                kernel::TaskKernelCpuLanes<TDim, TIdx, TKernelFnObj, TArgs...>>
+            {
+                using type = TIdx;
+            };
+        }
+    }
+}
+
+#endif
@@ -26,7 +26,7 @@
 #include <alpaka/acc/AccCpuOmp2Blocks.hpp>
 #include <alpaka/core/Decay.hpp>
 #include <alpaka/dev/DevCpu.hpp>
-#include <alpaka/idx/MapIdx.hpp>
+#include <alpaka/kernel/GridBlockTraversal.hpp>
 #include <alpaka/kernel/Traits.hpp>
 #include <alpaka/workdiv/WorkDivMembers.hpp>
 
@@ -34,6 +34,9 @@
 
 #include <omp.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <stdexcept>
 #include <tuple>
@@ -113,6 +116,21 @@ namespace alpaka
                         },
                         m_args));
 
+                // Get the schedule of the grid blocks.
+                auto const blockSchedule(
+                    meta::apply(
+                        [&](ALPAKA_DECAY_T(TArgs) const & ... args)
+                        {
+                            return
+                                kernel::getBlockSchedule<
+                                    acc::AccCpuOmp2Blocks<TDim, TIdx>>(
+                                        m_kernelFnObj,
+                                        blockThreadExtent,
+                                        threadElemExtent,
+                                        args...);
+                        },
+                        m_args));
+
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
                 std::cout << __func__
                     << " blockSharedMemDynSizeBytes: " << blockSharedMemDynSizeBytes << " B" << std::endl;
@@ -138,6 +156,11 @@ namespace alpaka
                     throw std::runtime_error("Only one thread per block allowed in the OpenMP 2.0 block accelerator!");
                 }
 
+                // The loop iterates over the blocks in the traversal order of the schedule.
+                detail::GridBlockTraversal<TDim, TIdx> const gridBlockTraversal(
+                    blockSchedule,
+                    gridBlockExtent);
+
                 if(::omp_in_parallel() != 0)
                 {
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
@@ -146,8 +169,9 @@ namespace alpaka
                     parallelFn(
                         boundKernelFnObj,
                         blockSharedMemDynSizeBytes,
+                        blockSchedule,
                         numBlocksInGrid,
-                        gridBlockExtent);
+                        gridBlockTraversal);
                 }
                 else
                 {
@@ -158,8 +182,9 @@ namespace alpaka
                     parallelFn(
                         boundKernelFnObj,
                         blockSharedMemDynSizeBytes,
+                        blockSchedule,
                         numBlocksInGrid,
-                        gridBlockExtent);
+                        gridBlockTraversal);
                 }
             }
 
@@ -169,8 +194,9 @@ namespace alpaka
             ALPAKA_FN_HOST auto parallelFn(
                 FnObj const & boundKernelFnObj,
                 TIdx const & blockSharedMemDynSizeBytes,
+                BlockSchedule const & blockSchedule,
                 TIdx const & numBlocksInGrid,
-                vec::Vec<TDim, TIdx> const & gridBlockExtent) const
+                detail::GridBlockTraversal<TDim, TIdx> const & gridBlockTraversal) const
             -> void
             {
                 #pragma omp single nowait
@@ -193,31 +219,66 @@ namespace alpaka
                     *static_cast<workdiv::WorkDivMembers<TDim, TIdx> const *>(this),
                     blockSharedMemDynSizeBytes);
 
-                // NOTE: schedule(static) does not improve performance.
-#if _OPENMP < 200805    // For OpenMP < 3.0 you have to declare the loop index (a signed integer) outside of the loop header.
-                std::intmax_t iNumBlocksInGrid(static_cast<std::intmax_t>(numBlocksInGrid));
-                std::intmax_t i;
-                #pragma omp for nowait schedule(guided)
-                for(i = 0; i < iNumBlocksInGrid; ++i)
-#else
-                #pragma omp for nowait schedule(guided)
-                for(TIdx i = 0; i < numBlocksInGrid; ++i)
-#endif
-                {
-#if _OPENMP < 200805
-                    auto const i_tidx  = static_cast<TIdx>(i); // for issue #840
-                    auto const index   = vec::Vec<dim::DimInt<1u>, TIdx>( i_tidx ); // for issue #840
+#if _OPENMP < 200805    // For OpenMP < 3.0 the loop index has to be a signed integer.
+                using LoopIdx = std::intmax_t;
 #else
-                    auto const index   = vec::Vec<dim::DimInt<1u>, TIdx>( i ); // for issue #840
+                using LoopIdx = TIdx;
 #endif
-                    acc.m_gridBlockIdx = idx::mapIdx<TDim::value>(index,
-                                                                  gridBlockExtent);
+                auto const blockFn(
+                    [&](LoopIdx const & i)
+                    {
+                        acc.m_gridBlockIdx = gridBlockTraversal.getGridBlockIdx(static_cast<TIdx>(i));
+
+                        boundKernelFnObj(
+                            acc);
+
+                        // After a block has been processed, the shared memory has to be deleted.
+                        block::shared::st::freeMem(acc);
+                    });
 
-                    boundKernelFnObj(
-                        acc);
+                LoopIdx const iNumBlocksInGrid(static_cast<LoopIdx>(numBlocksInGrid));
+                // The chunk size of the schedule clause has to be positive. One is the OpenMP default for dynamic and guided.
+                LoopIdx const chunkSize(static_cast<LoopIdx>(std::max(blockSchedule.m_chunkSize, static_cast<std::size_t>(1u))));
+                // For OpenMP < 3.0 you have to declare the loop index outside of the loop header.
+                LoopIdx i;
 
-                    // After a block has been processed, the shared memory has to be deleted.
-                    block::shared::st::freeMem(acc);
+                // All threads of the team see the same schedule so they all encounter the same worksharing loop.
+                switch(blockSchedule.m_policy)
+                {
+                case BlockSchedulingPolicy::Static:
+                    if(blockSchedule.m_chunkSize == 0u)
+                    {
+                        #pragma omp for nowait schedule(static)
+                        for(i = 0; i < iNumBlocksInGrid; ++i)
+                        {
+                            blockFn(i);
+                        }
+                    }
+                    else
+                    {
+                        #pragma omp for nowait schedule(static, chunkSize)
+                        for(i = 0; i < iNumBlocksInGrid; ++i)
+                        {
+                            blockFn(i);
+                        }
+                    }
+                    break;
+                case BlockSchedulingPolicy::Dynamic:
+                    #pragma omp for nowait schedule(dynamic, chunkSize)
+                    for(i = 0; i < iNumBlocksInGrid; ++i)
+                    {
+                        blockFn(i);
+                    }
+                    break;
+                // NOTE: The back-end defaults to guided because schedule(static) does not improve performance.
+                case BlockSchedulingPolicy::Auto:
+                case BlockSchedulingPolicy::Guided:
+                    #pragma omp for nowait schedule(guided, chunkSize)
+                    for(i = 0; i < iNumBlocksInGrid; ++i)
+                    {
+                        blockFn(i);
+                    }
+                    break;
                 }
             }
 
@@ -148,50 +148,60 @@ namespace alpaka
                 int const ompIsDynamic(::omp_get_dynamic());
                 ::omp_set_dynamic(0);
 
-                // Execute the blocks serially.
-                meta::ndLoopIncIdx(
-                    gridBlockExtent,
-                    [&](vec::Vec<TDim, TIdx> const & gridBlockIdx)
-                    {
-                        acc.m_gridBlockIdx = gridBlockIdx;
+                // Execute the threads in parallel.
 
-                        // Execute the threads in parallel.
+                // Parallel execution of the threads in a block is required because when syncBlockThreads is called all of them have to be done with their work up to this line.
+                // So we have to spawn one OS thread per thread in a block.
+                // 'omp for' is not useful because it is meant for cases where multiple iterations are executed by one thread but in our case a 1:1 mapping is required.
+                // Therefore we use 'omp parallel' with the specified number of threads in a block.
+                // The parallel region is opened once for all blocks instead of once for each block.
+                // This avoids forking and joining the team for each block and the threads stay on their cores.
+                #pragma omp parallel num_threads(iBlockThreadCount)
+                {
+                    // The guard is for gcc internal compiler error, as discussed in #735
+#if (!BOOST_COMP_GNUC) || (BOOST_COMP_GNUC >= BOOST_VERSION_NUMBER(8, 1, 0))
+                    #pragma omp single nowait
+                    {
+                        // The OpenMP runtime does not create a parallel region when only one thread is required in the num_threads clause.
+                        // In all other cases we expect to be in a parallel region now.
+                        if((iBlockThreadCount > 1) && (::omp_in_parallel() == 0))
+                        {
+                            throw std::runtime_error("The OpenMP 2.0 runtime did not create a parallel region!");
+                        }
 
-                        // Parallel execution of the threads in a block is required because when syncBlockThreads is called all of them have to be done with their work up to this line.
-                        // So we have to spawn one OS thread per thread in a block.
-                        // 'omp for' is not useful because it is meant for cases where multiple iterations are executed by one thread but in our case a 1:1 mapping is required.
-                        // Therefore we use 'omp parallel' with the specified number of threads in a block.
-                        #pragma omp parallel num_threads(iBlockThreadCount)
+                        int const numThreads(::omp_get_num_threads());
+                        if(numThreads != iBlockThreadCount)
                         {
-                            // The guard is for gcc internal compiler error, as discussed in #735
-#if (!BOOST_COMP_GNUC) || (BOOST_COMP_GNUC >= BOOST_VERSION_NUMBER(8, 1, 0))
-                            #pragma omp single nowait
+                            throw std::runtime_error("The OpenMP 2.0 runtime did not use the number of threads that had been required!");
+                        }
+                    }
+#endif
+                    // The team executes the blocks serially.
+                    meta::ndLoopIncIdx(
+                        gridBlockExtent,
+                        [&](vec::Vec<TDim, TIdx> const & gridBlockIdx)
+                        {
+                            #pragma omp master
                             {
-                                // The OpenMP runtime does not create a parallel region when only one thread is required in the num_threads clause.
-                                // In all other cases we expect to be in a parallel region now.
-                                if((iBlockThreadCount > 1) && (::omp_in_parallel() == 0))
-                                {
-                                    throw std::runtime_error("The OpenMP 2.0 runtime did not create a parallel region!");
-                                }
-
-                                int const numThreads(::omp_get_num_threads());
-                                if(numThreads != iBlockThreadCount)
-                                {
-                                    throw std::runtime_error("The OpenMP 2.0 runtime did not use the number of threads that had been required!");
-                                }
+                                acc.m_gridBlockIdx = gridBlockIdx;
                             }
-#endif
+                            // Wait for the master thread to switch to the new block.
+                            #pragma omp barrier
+
                             boundKernelFnObj(
                                 acc);
 
                             // Wait for all threads to finish before deleting the shared memory.
-                            // This is done by default if the omp 'nowait' clause is missing on the omp parallel directive
-                            //block::sync::syncBlockThreads(acc);
-                        }
+                            #pragma omp barrier
 
-                        // After a block has been processed, the shared memory has to be deleted.
-                        block::shared::st::freeMem(acc);
-                    });
+                            // After a block has been processed, the shared memory has to be deleted.
+                            // The other threads only touch it again after the barrier at the beginning of the next block.
+                            #pragma omp master
+                            {
+                                block::shared::st::freeMem(acc);
+                            }
+                        });
+                }
 
                 // Reset the dynamic thread number setting.
                 ::omp_set_dynamic(ompIsDynamic);
@@ -23,8 +23,8 @@
 #include <alpaka/core/Decay.hpp>
 #include <alpaka/core/Unused.hpp>
 #include <alpaka/dev/DevCpu.hpp>
+#include <alpaka/kernel/GridBlockTraversal.hpp>
 #include <alpaka/kernel/Traits.hpp>
-#include <alpaka/meta/NdLoop.hpp>
 #include <alpaka/meta/ApplyTuple.hpp>
 #include <alpaka/workdiv/WorkDivMembers.hpp>
 
@@ -109,6 +109,21 @@ namespace alpaka
                 std::cout << __func__
                     << " blockSharedMemDynSizeBytes: " << blockSharedMemDynSizeBytes << " B" << std::endl;
 #endif
+                // Get the block schedule. Only its traversal order is relevant for the serial execution.
+                auto const blockSchedule(
+                    meta::apply(
+                        [&](ALPAKA_DECAY_T(TArgs) const & ... args)
+                        {
+                            return
+                                kernel::getBlockSchedule<
+                                    acc::AccCpuSerial<TDim, TIdx>>(
+                                        m_kernelFnObj,
+                                        blockThreadExtent,
+                                        threadElemExtent,
+                                        args...);
+                        },
+                        m_args));
+
                 // Bind all arguments except the accelerator.
                 // TODO: With C++14 we could create a perfectly argument forwarding function object within the constructor.
                 auto const boundKernelFnObj(
@@ -132,12 +147,14 @@ namespace alpaka
                     throw std::runtime_error("A block for the serial accelerator can only ever have one single thread!");
                 }
 
-                // Execute the blocks serially.
-                meta::ndLoopIncIdx(
-                    gridBlockExtent,
-                    [&](vec::Vec<TDim, TIdx> const & blockThreadIdx)
+                // Execute the blocks serially in the traversal order of the schedule.
+                detail::GridBlockTraversal<TDim, TIdx> const gridBlockTraversal(
+                    blockSchedule,
+                    gridBlockExtent);
+                gridBlockTraversal.forEach(
+                    [&](vec::Vec<TDim, TIdx> const & gridBlockIdx)
                     {
-                        acc.m_gridBlockIdx = blockThreadIdx;
+                        acc.m_gridBlockIdx = gridBlockIdx;
 
                         boundKernelFnObj(
                             acc);
@@ -22,7 +22,7 @@
 #include <alpaka/acc/AccCpuTbbBlocks.hpp>
 #include <alpaka/core/Decay.hpp>
 #include <alpaka/dev/DevCpu.hpp>
-#include <alpaka/idx/MapIdx.hpp>
+#include <alpaka/kernel/GridBlockTraversal.hpp>
 #include <alpaka/kernel/Traits.hpp>
 #include <alpaka/workdiv/WorkDivMembers.hpp>
 
@@ -30,6 +30,7 @@
 #include <alpaka/meta/ApplyTuple.hpp>
 
 #include <functional>
+#include <memory>
 #include <stdexcept>
 #include <tuple>
 #include <type_traits>
@@ -37,10 +38,17 @@
     #include <iostream>
 #endif
 
+#include <tbb/enumerable_thread_specific.h>
 #include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
 #include <tbb/blocked_range.h>
 #include <tbb/task_group.h>
 
+//! The minimum number of grid blocks a TBB worker executes as one chunk if the block schedule of the kernel does not specify a chunk size.
+#ifndef ALPAKA_CPU_TBB_BLOCKS_GRAIN_SIZE
+    #define ALPAKA_CPU_TBB_BLOCKS_GRAIN_SIZE 1
+#endif
+
 namespace alpaka
 {
     namespace kernel
@@ -111,6 +119,21 @@ namespace alpaka
                         },
                         m_args));
 
+                // Get the schedule of the grid blocks.
+                auto const blockSchedule(
+                    meta::apply(
+                        [&](ALPAKA_DECAY_T(TArgs) const & ... args)
+                        {
+                            return
+                                kernel::getBlockSchedule<
+                                    acc::AccCpuTbbBlocks<TDim, TIdx>>(
+                                        m_kernelFnObj,
+                                        blockThreadExtent,
+                                        threadElemExtent,
+                                        args...);
+                        },
+                        m_args));
+
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
                 std::cout << __func__
                     << " blockSharedMemDynSizeBytes: " << blockSharedMemDynSizeBytes << " B" << std::endl;
@@ -137,27 +160,62 @@ namespace alpaka
                     throw std::runtime_error("A block for the TBB accelerator can only ever have one single thread!");
                 }
 
-                tbb::parallel_for(
+                // The range iterates over the blocks in the traversal order of the schedule.
+                detail::GridBlockTraversal<TDim, TIdx> const gridBlockTraversal(
+                    blockSchedule,
+                    gridBlockExtent);
+
+                // The accelerators are created lazily, once for each worker executing blocks of this kernel, instead of once for each block.
+                // Each of them contains the static and dynamic block shared memory arena.
+                tbb::enumerable_thread_specific<std::unique_ptr<acc::AccCpuTbbBlocks<TDim, TIdx>>> accs(
+                    [this, &blockSharedMemDynSizeBytes]()
+                    {
+                        // The constructor of the accelerator is only accessible to this task so std::make_unique can not be used.
+                        return
+                            std::unique_ptr<acc::AccCpuTbbBlocks<TDim, TIdx>>(
+                                new acc::AccCpuTbbBlocks<TDim, TIdx>(
+                                    *static_cast<workdiv::WorkDivMembers<TDim, TIdx> const *>(this),
+                                    blockSharedMemDynSizeBytes));
+                    });
+
+                // The chunk size of the schedule is the grain size of the range. The partitioner decides how the range is split up.
+                tbb::blocked_range<TIdx> const blockRange(
                     static_cast<TIdx>(0),
-                    static_cast<TIdx>(numBlocksInGrid),
-                    [&](TIdx i){
-                         acc::AccCpuTbbBlocks<TDim, TIdx> acc(
-                             *static_cast<workdiv::WorkDivMembers<TDim, TIdx> const *>(this),
-                             blockSharedMemDynSizeBytes);
+                    numBlocksInGrid,
+                    (blockSchedule.m_chunkSize != 0u) ? blockSchedule.m_chunkSize : static_cast<std::size_t>(ALPAKA_CPU_TBB_BLOCKS_GRAIN_SIZE));
+
+                auto const blockRangeFn(
+                    [&](tbb::blocked_range<TIdx> const & subRange)
+                    {
+                        auto & acc(*accs.local());
 
-                         acc.m_gridBlockIdx =
-                             idx::mapIdx<TDim::value>(
-                                 vec::Vec<dim::DimInt<1u>, TIdx>(
-                                     static_cast<TIdx>(i)
-                                  ),
-                                  gridBlockExtent
-                             );
+                        for(TIdx i(subRange.begin()); i != subRange.end(); ++i)
+                        {
+                            acc.m_gridBlockIdx = gridBlockTraversal.getGridBlockIdx(i);
 
-                         boundKernelFnObj(acc);
+                            boundKernelFnObj(acc);
 
-                         block::shared::st::freeMem(acc);
-                });
+                            // After a block has been processed, the shared memory has to be deleted.
+                            block::shared::st::freeMem(acc);
+                        }
+                    });
 
+                switch(blockSchedule.m_policy)
+                {
+                case BlockSchedulingPolicy::Static:
+                    // Splits the range evenly among the workers without stealing.
+                    tbb::parallel_for(blockRange, blockRangeFn, tbb::static_partitioner());
+                    break;
+                case BlockSchedulingPolicy::Dynamic:
+                    // Splits the range down to the grain size. The workers steal the chunks from each other.
+                    tbb::parallel_for(blockRange, blockRangeFn, tbb::simple_partitioner());
+                    break;
+                // The auto partitioner starts with large chunks and only splits them further when they are stolen.
+                case BlockSchedulingPolicy::Auto:
+                case BlockSchedulingPolicy::Guided:
+                    tbb::parallel_for(blockRange, blockRangeFn, tbb::auto_partitioner());
+                    break;
+                }
             }
 
         private:
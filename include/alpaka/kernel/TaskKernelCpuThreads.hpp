@@ -22,6 +22,8 @@
 #include <alpaka/acc/AccCpuThreads.hpp>
 #include <alpaka/core/Decay.hpp>
 #include <alpaka/dev/DevCpu.hpp>
+#include <alpaka/dev/cpu/ExecContext.hpp>
+#include <alpaka/kernel/GridBlockTraversal.hpp>
 #include <alpaka/kernel/Traits.hpp>
 #include <alpaka/workdiv/WorkDivMembers.hpp>
 
@@ -31,12 +33,15 @@
 #include <alpaka/meta/ApplyTuple.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 #include <tuple>
 #include <type_traits>
-#include <future>
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
     #include <iostream>
 #endif
@@ -45,6 +50,153 @@ namespace alpaka
 {
     namespace kernel
     {
+        namespace detail
+        {
+            //#############################################################################
+            //! Hands out the grid blocks of a kernel to the blocks in flight of the CPU threads execution task.
+            //!
+            //! Each block in flight is assigned chunks of consecutive grid blocks according to the block schedule of the kernel.
+            //! Only the master thread of a block in flight requests grid blocks for it.
+            template<
+                typename TIdx>
+            class GridBlockScheduler
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                GridBlockScheduler(
+                    BlockSchedule const & blockSchedule,
+                    TIdx const & gridBlockCount,
+                    std::size_t const & blocksInFlightCount) :
+                        m_policy(blockSchedule.m_policy),
+                        m_chunkSize(getChunkSize(blockSchedule, gridBlockCount, blocksInFlightCount)),
+                        m_gridBlockCount(gridBlockCount),
+                        m_blocksInFlightCount(static_cast<TIdx>(blocksInFlightCount)),
+                        m_nextGridBlock(0u),
+                        m_chunks(blocksInFlightCount)
+                {}
+                //-----------------------------------------------------------------------------
+                GridBlockScheduler(GridBlockScheduler const &) = delete;
+                //-----------------------------------------------------------------------------
+                GridBlockScheduler(GridBlockScheduler &&) = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(GridBlockScheduler const &) -> GridBlockScheduler & = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(GridBlockScheduler &&) -> GridBlockScheduler & = delete;
+
+                //-----------------------------------------------------------------------------
+                //! \return The linear index of the next grid block the given block in flight has to execute or the grid block count if there is none left.
+                auto nextGridBlock(
+                    std::size_t const & blockInFlight)
+                -> TIdx
+                {
+                    auto & chunk(m_chunks[blockInFlight]);
+                    if(chunk.m_begin == chunk.m_end)
+                    {
+                        assignChunk(blockInFlight, chunk);
+                        if(chunk.m_begin == chunk.m_end)
+                        {
+                            return m_gridBlockCount;
+                        }
+                    }
+                    return chunk.m_begin++;
+                }
+
+            private:
+                //#############################################################################
+                //! The grid blocks assigned to a block in flight which have not been executed yet.
+                struct Chunk
+                {
+                    //-----------------------------------------------------------------------------
+                    Chunk() :
+                        m_begin(0u),
+                        m_end(0u),
+                        m_assignedChunkCount(0u)
+                    {}
+
+                    TIdx m_begin;
+                    TIdx m_end;
+                    TIdx m_assignedChunkCount;  //!< The number of chunks assigned to the block in flight so far. Only used by the static policy.
+                };
+
+                //-----------------------------------------------------------------------------
+                //! \return The chunk size of the schedule or the default chunk size of the policy.
+                static auto getChunkSize(
+                    BlockSchedule const & blockSchedule,
+                    TIdx const & gridBlockCount,
+                    std::size_t const & blocksInFlightCount)
+                -> TIdx
+                {
+                    if(blockSchedule.m_chunkSize != 0u)
+                    {
+                        return static_cast<TIdx>(blockSchedule.m_chunkSize);
+                    }
+                    // Without a chunk size each block in flight statically gets one contiguous range of grid blocks.
+                    if(blockSchedule.m_policy == BlockSchedulingPolicy::Static)
+                    {
+                        auto const blocksInFlight(static_cast<TIdx>(blocksInFlightCount));
+                        return std::max(static_cast<TIdx>((gridBlockCount + blocksInFlight - static_cast<TIdx>(1u)) / blocksInFlight), static_cast<TIdx>(1u));
+                    }
+                    return static_cast<TIdx>(1u);
+                }
+                //-----------------------------------------------------------------------------
+                //! Assigns the next chunk to the given block in flight. The chunk is empty if all grid blocks have been assigned.
+                auto assignChunk(
+                    std::size_t const & blockInFlight,
+                    Chunk & chunk)
+                -> void
+                {
+                    TIdx begin(m_gridBlockCount);
+                    TIdx size(m_chunkSize);
+
+                    switch(m_policy)
+                    {
+                    case BlockSchedulingPolicy::Static:
+                        {
+                            // The block in flight k executes the chunks k, k + blocksInFlightCount, k + 2 * blocksInFlightCount, ...
+                            auto const chunkIdx(static_cast<TIdx>(chunk.m_assignedChunkCount * m_blocksInFlightCount + static_cast<TIdx>(blockInFlight)));
+                            ++chunk.m_assignedChunkCount;
+                            if(chunkIdx < (m_gridBlockCount + m_chunkSize - static_cast<TIdx>(1u)) / m_chunkSize)
+                            {
+                                begin = static_cast<TIdx>(chunkIdx * m_chunkSize);
+                            }
+                        }
+                        break;
+                    case BlockSchedulingPolicy::Guided:
+                        {
+                            // The chunks are proportional to the number of unassigned grid blocks but not smaller than the chunk size.
+                            begin = m_nextGridBlock.load();
+                            do
+                            {
+                                if(begin >= m_gridBlockCount)
+                                {
+                                    break;
+                                }
+                                size = std::max(static_cast<TIdx>((m_gridBlockCount - begin) / m_blocksInFlightCount), m_chunkSize);
+                            }
+                            while(!m_nextGridBlock.compare_exchange_weak(begin, static_cast<TIdx>(begin + size)));
+                        }
+                        break;
+                    // By default each block in flight fetches one grid block after the other.
+                    case BlockSchedulingPolicy::Auto:
+                    case BlockSchedulingPolicy::Dynamic:
+                        begin = m_nextGridBlock.fetch_add(m_chunkSize);
+                        break;
+                    }
+
+                    chunk.m_begin = std::min(begin, m_gridBlockCount);
+                    chunk.m_end = (m_gridBlockCount - chunk.m_begin > size) ? static_cast<TIdx>(chunk.m_begin + size) : m_gridBlockCount;
+                }
+
+            private:
+                BlockSchedulingPolicy const m_policy;
+                TIdx const m_chunkSize;
+                TIdx const m_gridBlockCount;
+                TIdx const m_blocksInFlightCount;
+                std::atomic<TIdx> m_nextGridBlock;
+                std::vector<Chunk> m_chunks;    //!< The chunk of each block in flight.
+            };
+        }
+
         //#############################################################################
         //! The CPU threads execution task.
         template<
@@ -57,26 +209,12 @@ namespace alpaka
         {
         private:
             //#############################################################################
-            //! The type given to the ConcurrentExecPool for yielding the current thread.
-            struct ThreadPoolYield
-            {
-                //-----------------------------------------------------------------------------
-                //! Yields the current thread.
-                ALPAKA_FN_HOST static auto yield()
-                -> void
-                {
-                    std::this_thread::yield();
-                }
-            };
+            // The threads of the pool wait on a condition variable for new blocks.
+            // The synchronization within a block (syncBlockThreads) is still done by the spinning block barrier.
+            using ThreadPool = dev::cpu::detail::BlockThreadPool;
             //#############################################################################
-            // When using the thread pool the threads are yielding because this is faster.
-            // Using condition variables and going to sleep is very costly for real threads.
-            // Especially when the time to wait is really short (syncBlockThreads) yielding is much faster.
-            using ThreadPool = alpaka::core::detail::ConcurrentExecPool<
-                TIdx,
-                std::thread,        // The concurrent execution type.
-                std::promise,       // The promise type.
-                ThreadPoolYield>;   // The type yielding the current concurrent execution.
+            // The completion of all block threads of a kernel launch is signaled to a single latch.
+            using Latch = core::detail::CompletionLatch<std::mutex, std::condition_variable>;
 
         public:
             //-----------------------------------------------------------------------------
@@ -107,11 +245,76 @@ namespace alpaka
 
             //-----------------------------------------------------------------------------
             //! Executes the kernel function object.
+            //! Within a task of a CPU queue the block threads are executed by a pool leased from the device of the queue.
+            //! This avoids creating and joining the threads on each kernel launch.
+            //! Kernels of higher priority queues are the first to lease a pool when the device limits the number of block threads.
+            //! Outside of a queue the block threads are executed by a pool living only for the duration of this call.
             ALPAKA_FN_HOST auto operator()() const
             -> void
             {
                 ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
 
+                auto const concurrentThreadCount(getConcurrentThreadCount());
+
+                auto const * const pContext(dev::cpu::detail::ExecContext::getCurrent());
+                if(pContext == nullptr)
+                {
+                    ThreadPool threadPool(concurrentThreadCount);
+
+                    gridExecHost(threadPool);
+                    return;
+                }
+
+                auto & devImpl(pContext->m_devImpl);
+                auto upThreadPool(devImpl.acquireBlockThreadPool(concurrentThreadCount, pContext->m_priority));
+
+                try
+                {
+                    gridExecHost(*upThreadPool);
+                }
+                catch(...)
+                {
+                    // The threads have to be handed back, otherwise they would stay claimed forever.
+                    devImpl.releaseBlockThreadPool(std::move(upThreadPool), concurrentThreadCount);
+                    throw;
+                }
+
+                devImpl.releaseBlockThreadPool(std::move(upThreadPool), concurrentThreadCount);
+            }
+
+        private:
+            //-----------------------------------------------------------------------------
+            //! \return The number of threads in each block.
+            ALPAKA_FN_HOST auto getBlockThreadCount() const
+            -> std::size_t
+            {
+                return static_cast<std::size_t>(workdiv::getWorkDiv<Block, Threads>(*this).prod());
+            }
+            //-----------------------------------------------------------------------------
+            //! \return The number of grid blocks executed concurrently.
+            //! As many blocks are kept in flight as the hardware can execute the threads of concurrently, but at least one.
+            ALPAKA_FN_HOST auto getBlocksInFlightCount() const
+            -> std::size_t
+            {
+                auto const gridBlockCount(static_cast<std::size_t>(workdiv::getWorkDiv<Grid, Blocks>(*this).prod()));
+                auto const hardwareThreadCount(static_cast<std::size_t>(std::thread::hardware_concurrency()));
+
+                return std::max(std::min(gridBlockCount, hardwareThreadCount / getBlockThreadCount()), static_cast<std::size_t>(1u));
+            }
+            //-----------------------------------------------------------------------------
+            //! \return The number of threads required to execute all blocks in flight.
+            ALPAKA_FN_HOST auto getConcurrentThreadCount() const
+            -> std::size_t
+            {
+                return getBlocksInFlightCount() * getBlockThreadCount();
+            }
+            //-----------------------------------------------------------------------------
+            //! Executes all grid blocks using the given thread pool.
+            //! The pool has to contain at least getConcurrentThreadCount() threads.
+            ALPAKA_FN_HOST auto gridExecHost(
+                ThreadPool & threadPool) const
+            -> void
+            {
                 auto const gridBlockExtent(
                     workdiv::getWorkDiv<Grid, Blocks>(*this));
                 auto const blockThreadExtent(
@@ -134,166 +337,176 @@ namespace alpaka
                         },
                         m_args));
 
-#if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
-                std::cout << __func__
-                    << " blockSharedMemDynSizeBytes: " << blockSharedMemDynSizeBytes << " B" << std::endl;
-#endif
-                acc::AccCpuThreads<TDim, TIdx> acc(
-                    *static_cast<workdiv::WorkDivMembers<TDim, TIdx> const *>(this),
-                    blockSharedMemDynSizeBytes);
-
-                auto const blockThreadCount(blockThreadExtent.prod());
-                ThreadPool threadPool(blockThreadCount);
-
-                // Bind the kernel and its arguments to the grid block function.
-                auto const boundGridBlockExecHost(
+                // Get the schedule of the grid blocks.
+                auto const blockSchedule(
                     meta::apply(
-                        [this, &acc, &blockThreadExtent, &threadPool](ALPAKA_DECAY_T(TArgs) const & ... args)
+                        [&](ALPAKA_DECAY_T(TArgs) const & ... args)
                         {
                             return
-                                std::bind(
-                                    &TaskKernelCpuThreads::gridBlockExecHost,
-                                    std::ref(acc),
-                                    std::placeholders::_1,
-                                    std::ref(blockThreadExtent),
-                                    std::ref(threadPool),
-                                    std::ref(m_kernelFnObj),
-                                    std::ref(args)...);
+                                kernel::getBlockSchedule<
+                                    acc::AccCpuThreads<TDim, TIdx>>(
+                                        m_kernelFnObj,
+                                        blockThreadExtent,
+                                        threadElemExtent,
+                                        args...);
                         },
                         m_args));
 
-                // Execute the blocks serially.
-                meta::ndLoopIncIdx(
-                    gridBlockExtent,
-                    boundGridBlockExecHost);
-            }
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
+                std::cout << __func__
+                    << " blockSharedMemDynSizeBytes: " << blockSharedMemDynSizeBytes << " B" << std::endl;
+#endif
+                auto const blocksInFlightCount(getBlocksInFlightCount());
 
-        private:
-            //-----------------------------------------------------------------------------
-            //! The function executed for each grid block.
-            ALPAKA_FN_HOST static auto gridBlockExecHost(
-                acc::AccCpuThreads<TDim, TIdx> & acc,
-                vec::Vec<TDim, TIdx> const & gridBlockIdx,
-                vec::Vec<TDim, TIdx> const & blockThreadExtent,
-                ThreadPool & threadPool,
-                TKernelFnObj const & kernelFnObj,
-                std::decay_t<TArgs> const & ... args)
-            -> void
-            {
-                    // The futures of the threads in the current block.
-                std::vector<std::future<void>> futuresInBlock;
-
-                // Set the index of the current block
-                acc.m_gridBlockIdx = gridBlockIdx;
-
-                // Bind the kernel and its arguments to the host block thread execution function.
-                auto boundBlockThreadExecHost(std::bind(
-                    &TaskKernelCpuThreads::blockThreadExecHost,
-                    std::ref(acc),
-                    std::ref(futuresInBlock),
-                    std::placeholders::_1,
-                    std::ref(threadPool),
-                    std::ref(kernelFnObj),
-                    std::ref(args)...));
-                // Execute the block threads in parallel.
-                meta::ndLoopIncIdx(
-                    blockThreadExtent,
-                    boundBlockThreadExecHost);
-// Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
-#if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
-                // Wait for the completion of the block thread kernels.
-                std::for_each(
-                    futuresInBlock.begin(),
-                    futuresInBlock.end(),
-                    [](std::future<void> & t)
+                // The blocks in flight fetch the next grid block to execute from this scheduler.
+                detail::GridBlockScheduler<TIdx> gridBlockScheduler(
+                    blockSchedule,
+                    gridBlockExtent.prod(),
+                    blocksInFlightCount);
+                // The scheduler distributes the positions of the blocks in the traversal order of the schedule.
+                detail::GridBlockTraversal<TDim, TIdx> const gridBlockTraversal(
+                    blockSchedule,
+                    gridBlockExtent);
+
+                // Each block in flight has its own accelerator with its own barrier, static shared memory and thread index map.
+                std::vector<std::unique_ptr<acc::AccCpuThreads<TDim, TIdx>>> accs;
+                accs.reserve(blocksInFlightCount);
+                for(std::size_t blockInFlight(0u); blockInFlight < blocksInFlightCount; ++blockInFlight)
+                {
+                    // The constructor of the accelerator is only accessible to this task so std::make_unique can not be used.
+                    accs.emplace_back(
+                        new acc::AccCpuThreads<TDim, TIdx>(
+                            *static_cast<workdiv::WorkDivMembers<TDim, TIdx> const *>(this),
+                            blockSharedMemDynSizeBytes));
+                }
+                // The linear index of the grid block currently executed by each block in flight.
+                std::vector<TIdx> currentGridBlocks(blocksInFlightCount);
+
+                // Creates the function executed by a single block thread of a block in flight.
+                auto const makeBlockThreadTask(
+                    [this, &gridBlockScheduler, &gridBlockExtent, &gridBlockTraversal](
+                        acc::AccCpuThreads<TDim, TIdx> & acc,
+                        std::size_t const & blockInFlight,
+                        TIdx & currentGridBlock,
+                        vec::Vec<TDim, TIdx> const & blockThreadIdx)
                     {
-                        t.wait();
-                    }
-                );
-#endif
-                // Clean up.
-                futuresInBlock.clear();
+                        // The blockThreadIdx is required to be copied in because the variable will get changed for the next iteration/thread.
+                        return
+                            [this, &acc, blockInFlight, &currentGridBlock, &gridBlockScheduler, &gridBlockExtent, &gridBlockTraversal, blockThreadIdx]()
+                            {
+                                meta::apply(
+                                    [&](ALPAKA_DECAY_T(TArgs) const & ... args)
+                                    {
+                                        blockThreadExecAcc(
+                                            acc,
+                                            blockThreadIdx,
+                                            gridBlockExtent,
+                                            gridBlockTraversal,
+                                            gridBlockScheduler,
+                                            blockInFlight,
+                                            currentGridBlock,
+                                            m_kernelFnObj,
+                                            args...);
+                                    },
+                                    m_args);
+                            };
+                    });
+                using BlockThreadTask = core::detail::IntrusiveTaskPkg<
+                    Latch,
+                    decltype(makeBlockThreadTask(*accs.back(), 0u, currentGridBlocks.front(), vec::Vec<TDim, TIdx>::zeros()))>;
 
-                acc.m_threadToIndexMap.clear();
+                // The tasks of the threads of all blocks in flight are allocated at once and signal their completion to a single latch.
+                // This avoids a heap allocation and a future for each thread.
+                auto const blockThreadTaskCount(blocksInFlightCount * getBlockThreadCount());
+                Latch latch(blockThreadTaskCount);
+                std::vector<BlockThreadTask> blockThreadTasks;
+                blockThreadTasks.reserve(blockThreadTaskCount);
 
-                // After a block has been processed, the shared memory has to be deleted.
-                block::shared::st::freeMem(acc);
-            }
-            //-----------------------------------------------------------------------------
-            //! The function executed for each block thread on the host.
-            ALPAKA_FN_HOST static auto blockThreadExecHost(
-                acc::AccCpuThreads<TDim, TIdx> & acc,
+                for(std::size_t blockInFlight(0u); blockInFlight < blocksInFlightCount; ++blockInFlight)
+                {
+                    auto & acc(*accs[blockInFlight]);
+                    auto & currentGridBlock(currentGridBlocks[blockInFlight]);
+
+                    // Execute the block threads in parallel.
+                    meta::ndLoopIncIdx(
+                        blockThreadExtent,
+                        [&](vec::Vec<TDim, TIdx> const & blockThreadIdx)
+                        {
+                            // The vector has been reserved so the tasks already enqueued are never moved.
+                            blockThreadTasks.emplace_back(
+                                latch,
+                                makeBlockThreadTask(acc, blockInFlight, currentGridBlock, blockThreadIdx));
+// Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
 #if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
-                std::vector<std::future<void>> & futuresInBlock,
-                vec::Vec<TDim, TIdx> const & blockThreadIdx,
-                ThreadPool & threadPool,
+                            threadPool.enqueueIntrusiveTask(blockThreadTasks.back());
 #else
-                std::vector<std::future<void>> &,
-                vec::Vec<TDim, TIdx> const & blockThreadIdx,
-                ThreadPool &,
+                            alpaka::ignore_unused(threadPool);
 #endif
-                TKernelFnObj const & kernelFnObj,
-                std::decay_t<TArgs> const & ... args)
-            -> void
-            {
-                // Bind the arguments to the accelerator block thread execution function.
-                // The blockThreadIdx is required to be copied in because the variable will get changed for the next iteration/thread.
-                auto boundBlockThreadExecAcc(
-                    [&, blockThreadIdx]()
-                    {
-                        blockThreadExecAcc(
-                            acc,
-                            blockThreadIdx,
-                            kernelFnObj,
-                            args...);
-                    });
-                // Add the bound function to the block thread pool.
+                        });
+                }
 // Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
 #if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
-                futuresInBlock.emplace_back(
-                    threadPool.enqueueTask(
-                        boundBlockThreadExecAcc));
-#else
-                (void)boundBlockThreadExecAcc;
+                // Wait for the completion of all blocks.
+                latch.wait();
 #endif
             }
             //-----------------------------------------------------------------------------
             //! The thread entry point on the accelerator.
+            //! The threads of a block in flight execute grid blocks until all of them have been processed.
             ALPAKA_FN_HOST static auto blockThreadExecAcc(
                 acc::AccCpuThreads<TDim, TIdx> & acc,
                 vec::Vec<TDim, TIdx> const & blockThreadIdx,
+                vec::Vec<TDim, TIdx> const & gridBlockExtent,
+                detail::GridBlockTraversal<TDim, TIdx> const & gridBlockTraversal,
+                detail::GridBlockScheduler<TIdx> & gridBlockScheduler,
+                std::size_t const & blockInFlight,
+                TIdx & currentGridBlock,
                 TKernelFnObj const & kernelFnObj,
                 std::decay_t<TArgs> const & ... args)
             -> void
             {
-                // We have to store the thread data before the kernel is calling any of the methods of this class depending on them.
-                auto const threadId(std::this_thread::get_id());
+                bool const isMasterThread(blockThreadIdx.sum() == 0);
+                auto const gridBlockCount(gridBlockExtent.prod());
 
-                // Set the master thread id.
-                if(blockThreadIdx.sum() == 0)
-                {
-                    acc.m_idMasterThread = threadId;
-                }
+                // Each thread only publishes its own index so the threads of the block do not have to wait for each other.
+                idx::bt::IdxBtThreadLocal<TDim, TIdx>::setBlockThreadIdx(&blockThreadIdx);
 
+                while(true)
                 {
-                    // The insertion of elements has to be done one thread at a time.
-                    std::lock_guard<std::mutex> lock(acc.m_mtxMapInsert);
+                    // The master thread fetches the next grid block.
+                    if(isMasterThread)
+                    {
+                        currentGridBlock = gridBlockScheduler.nextGridBlock(blockInFlight);
+                        if(currentGridBlock < gridBlockCount)
+                        {
+                            acc.m_gridBlockIdx = gridBlockTraversal.getGridBlockIdx(currentGridBlock);
+                        }
+                    }
 
-                    // Save the thread id, and index.
-                    acc.m_threadToIndexMap.emplace(threadId, blockThreadIdx);
-                }
+                    // Sync all threads so that all of them see the new grid block.
+                    syncBlockThreads(acc);
+
+                    if(currentGridBlock >= gridBlockCount)
+                    {
+                        break;
+                    }
 
-                // Sync all threads so that the maps with thread id's are complete and not changed after here.
-                syncBlockThreads(acc);
+                    // Execute the kernel itself.
+                    kernelFnObj(
+                        const_cast<acc::AccCpuThreads<TDim, TIdx> const &>(acc),
+                        args...);
 
-                // Execute the kernel itself.
-                kernelFnObj(
-                    const_cast<acc::AccCpuThreads<TDim, TIdx> const &>(acc),
-                    args...);
+                    // Sync all threads so that no thread is still working on the block while the master thread switches to the next one.
+                    syncBlockThreads(acc);
+
+                    // After a block has been processed, the shared memory has to be deleted.
+                    if(isMasterThread)
+                    {
+                        block::shared::st::freeMem(acc);
+                    }
+                }
 
-                // We have to sync all threads here because if a thread would finish before all threads have been started,
-                // a new thread could get the recycled (then duplicate) thread id!
-                syncBlockThreads(acc);
+                idx::bt::IdxBtThreadLocal<TDim, TIdx>::setBlockThreadIdx(nullptr);
             }
 
             TKernelFnObj m_kernelFnObj;
@@ -23,6 +23,7 @@
     #include <alpaka/workdiv/Traits.hpp>
 #endif
 
+#include <cstddef>
 #include <type_traits>
 
 //-----------------------------------------------------------------------------
@@ -33,6 +34,54 @@ namespace alpaka
     //! The kernel specifics.
     namespace kernel
     {
+        //#############################################################################
+        //! The policies for distributing the grid blocks of a kernel among the workers of a CPU back-end executing blocks in parallel.
+        enum class BlockSchedulingPolicy
+        {
+            Auto,       //!< The back-end chooses the schedule.
+            Static,     //!< The chunks are assigned round-robin before the execution. Without a chunk size, each worker gets one contiguous range of blocks.
+            Dynamic,    //!< Each worker fetches the next chunk as soon as it has finished the previous one.
+            Guided      //!< Like Dynamic but the chunks start large and shrink down to the chunk size.
+        };
+
+        //#############################################################################
+        //! The orders in which the CPU back-ends traverse the grid blocks of a kernel.
+        //! The scheduling policy distributes consecutive blocks of this order to the workers.
+        enum class BlockTraversalOrder
+        {
+            RowMajor,   //!< The last dimension is the fastest varying one. This is the order of idx::mapIdx.
+            Tiled,      //!< The grid is split into row-major tiles whose blocks are traversed row-major.
+            ZOrder,     //!< The blocks are traversed along the Z-order (Morton) curve.
+            Hilbert     //!< The blocks are traversed along the Hilbert curve. Works best for grids with similar extents in all dimensions.
+        };
+
+        //#############################################################################
+        //! The block schedule of a kernel.
+        struct BlockSchedule
+        {
+            //-----------------------------------------------------------------------------
+            //! \param policy The scheduling policy.
+            //! \param chunkSize The number of consecutive grid blocks assigned to a worker at once (the minimum for the guided policy).
+            //! Zero selects the default of the back-end.
+            //! \param traversalOrder The order in which the grid blocks are traversed.
+            //! \param tileSize The number of blocks along each dimension of a tile of BlockTraversalOrder::Tiled. Zero selects a default of four.
+            ALPAKA_FN_HOST BlockSchedule(
+                BlockSchedulingPolicy policy = BlockSchedulingPolicy::Auto,
+                std::size_t chunkSize = 0u,
+                BlockTraversalOrder traversalOrder = BlockTraversalOrder::RowMajor,
+                std::size_t tileSize = 0u) :
+                    m_policy(policy),
+                    m_chunkSize(chunkSize),
+                    m_traversalOrder(traversalOrder),
+                    m_tileSize(tileSize)
+            {}
+
+            BlockSchedulingPolicy m_policy;
+            std::size_t m_chunkSize;
+            BlockTraversalOrder m_traversalOrder;
+            std::size_t m_tileSize;
+        };
+
         //-----------------------------------------------------------------------------
         //! The kernel traits.
         namespace traits
@@ -94,6 +143,54 @@ namespace alpaka
                     return 0;
                 }
             };
+
+            //#############################################################################
+            //! The trait for getting the block schedule of a kernel.
+            //!
+            //! \tparam TKernelFnObj The kernel function object.
+            //! \tparam TAcc The accelerator.
+            //!
+            //! The default implementation returns BlockSchedulingPolicy::Auto.
+            //! It is honored by the back-ends executing grid blocks in parallel on the CPU (OpenMP 2.0 blocks, TBB blocks and threads).
+            template<
+                typename TKernelFnObj,
+                typename TAcc,
+                typename TSfinae = void>
+            struct GetBlockSchedule
+            {
+#if BOOST_COMP_CLANG
+    #pragma clang diagnostic push
+    #pragma clang diagnostic ignored "-Wdocumentation"  // clang does not support the syntax for variadic template arguments "args,..."
+#endif
+                //-----------------------------------------------------------------------------
+                //! \param kernelFnObj The kernel object for which the block schedule should be returned.
+                //! \param blockThreadExtent The block thread extent.
+                //! \param threadElemExtent The thread element extent.
+                //! \tparam TArgs The kernel invocation argument types pack.
+                //! \param args,... The kernel invocation arguments.
+                //! \return The block schedule of the kernel.
+                //! The default version always returns BlockSchedulingPolicy::Auto.
+#if BOOST_COMP_CLANG
+    #pragma clang diagnostic pop
+#endif
+                template<
+                    typename TDim,
+                    typename... TArgs>
+                ALPAKA_FN_HOST static auto getBlockSchedule(
+                    TKernelFnObj const & kernelFnObj,
+                    vec::Vec<TDim, idx::Idx<TAcc>> const & blockThreadExtent,
+                    vec::Vec<TDim, idx::Idx<TAcc>> const & threadElemExtent,
+                    TArgs const & ... args)
+                -> BlockSchedule
+                {
+                    alpaka::ignore_unused(kernelFnObj);
+                    alpaka::ignore_unused(blockThreadExtent);
+                    alpaka::ignore_unused(threadElemExtent);
+                    alpaka::ignore_unused(args...);
+
+                    return BlockSchedule();
+                }
+            };
         }
 
 #if BOOST_COMP_CLANG
@@ -135,6 +232,44 @@ namespace alpaka
                     args...);
         }
 
+#if BOOST_COMP_CLANG
+    #pragma clang diagnostic push
+    #pragma clang diagnostic ignored "-Wdocumentation"  // clang does not support the syntax for variadic template arguments "args,..."
+#endif
+        //-----------------------------------------------------------------------------
+        //! \tparam TAcc The accelerator type.
+        //! \param kernelFnObj The kernel object for which the block schedule should be returned.
+        //! \param blockThreadExtent The block thread extent.
+        //! \param threadElemExtent The thread element extent.
+        //! \param args,... The kernel invocation arguments.
+        //! \return The block schedule of the kernel.
+        //! The default implementation always returns BlockSchedulingPolicy::Auto.
+#if BOOST_COMP_CLANG
+    #pragma clang diagnostic pop
+#endif
+        template<
+            typename TAcc,
+            typename TKernelFnObj,
+            typename TDim,
+            typename... TArgs>
+        ALPAKA_FN_HOST auto getBlockSchedule(
+            TKernelFnObj const & kernelFnObj,
+            vec::Vec<TDim, idx::Idx<TAcc>> const & blockThreadExtent,
+            vec::Vec<TDim, idx::Idx<TAcc>> const & threadElemExtent,
+            TArgs const & ... args)
+        -> BlockSchedule
+        {
+            return
+                traits::GetBlockSchedule<
+                    TKernelFnObj,
+                    TAcc>
+                ::getBlockSchedule(
+                    kernelFnObj,
+                    blockThreadExtent,
+                    threadElemExtent,
+                    args...);
+        }
+
 #if BOOST_COMP_CLANG
     #pragma clang diagnostic push
     #pragma clang diagnostic ignored "-Wdocumentation"  // clang does not support the syntax for variadic template arguments "args,..."
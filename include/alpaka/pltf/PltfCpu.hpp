@@ -13,6 +13,8 @@
 #include <alpaka/dev/DevCpu.hpp>
 #include <alpaka/core/Concepts.hpp>
 
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <vector>
 
@@ -67,6 +69,8 @@ namespace alpaka
 
             //#############################################################################
             //! The CPU platform device get trait specialization.
+            //!
+            //! All handles to a device share its state (queues, block thread pools and executor) as long as any of them is alive.
             template<>
             struct GetDevByIdx<
                 pltf::PltfCpu>
@@ -86,7 +90,18 @@ namespace alpaka
                         throw std::runtime_error(ssErr.str());
                     }
 
-                    return {};
+                    // The state is not kept alive beyond the last handle, so no threads are left running on program exit.
+                    static std::mutex mtx;
+                    static std::vector<std::weak_ptr<dev::cpu::detail::DevCpuImpl>> vwpDevCpuImpls(devCount);
+
+                    std::lock_guard<std::mutex> lk(mtx);
+                    auto spDevCpuImpl(vwpDevCpuImpls[devIdx].lock());
+                    if(!spDevCpuImpl)
+                    {
+                        spDevCpuImpl = std::make_shared<dev::cpu::detail::DevCpuImpl>();
+                        vwpDevCpuImpls[devIdx] = spDevCpuImpl;
+                    }
+                    return dev::DevCpu(std::move(spDevCpuImpl));
                 }
             };
         }
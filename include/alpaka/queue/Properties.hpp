@@ -24,6 +24,21 @@ namespace alpaka
             //#############################################################################
             //! The caller is NOT waiting until the enqueued task is finished
             struct NonBlocking;
+
+            //#############################################################################
+            //! The caller is NOT waiting until the enqueued task is finished
+            //! but executes tasks estimated to be cheap itself while the queue is idle
+            struct NonBlockingInline;
+
+            //#############################################################################
+            //! The priority of the tasks of a queue relative to the tasks of the other queues of the same device.
+            //! Only supported by the CPU queues. The tasks of queues with a higher priority are started first.
+            enum class Priority
+            {
+                Low,
+                Normal,
+                High
+            };
         }
 
         using namespace property;
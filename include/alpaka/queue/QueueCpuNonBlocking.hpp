@@ -17,5 +17,6 @@ namespace alpaka
     namespace queue
     {
         using QueueCpuNonBlocking = QueueGenericThreadsNonBlocking<dev::DevCpu>;
+        using QueueCpuNonBlockingInline = QueueGenericThreadsNonBlocking<dev::DevCpu, queue::NonBlockingInline>;
     }
 }
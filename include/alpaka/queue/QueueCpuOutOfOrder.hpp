@@ -0,0 +1,21 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/queue/QueueGenericThreadsOutOfOrder.hpp>
+#include <alpaka/event/EventCpu.hpp>
+
+namespace alpaka
+{
+    namespace queue
+    {
+        using QueueCpuOutOfOrder = QueueGenericThreadsOutOfOrder<dev::DevCpu>;
+    }
+}
@@ -16,6 +16,8 @@
 #include <alpaka/queue/Traits.hpp>
 #include <alpaka/wait/Traits.hpp>
 
+#include <alpaka/dev/cpu/ExecContext.hpp>
+#include <alpaka/queue/Properties.hpp>
 #include <alpaka/queue/cpu/IGenericThreadsQueue.hpp>
 
 #include <atomic>
@@ -56,9 +58,11 @@ namespace alpaka
                 {
                 public:
                     //-----------------------------------------------------------------------------
-                    explicit QueueGenericThreadsBlockingImpl(
-                        TDev const & dev) noexcept :
+                    QueueGenericThreadsBlockingImpl(
+                        TDev const & dev,
+                        queue::Priority const priority) noexcept :
                             m_dev(dev),
+                            m_priority(priority),
                             m_bCurrentlyExecutingTask(false)
                     {}
                     //-----------------------------------------------------------------------------
@@ -84,6 +88,7 @@ namespace alpaka
 
                 public:
                     TDev const m_dev;            //!< The device this queue is bound to.
+                    queue::Priority const m_priority;   //!< The priority of the kernels of this queue when they lease block threads from the device.
                     std::mutex mutable m_mutex;
                     std::atomic<bool> m_bCurrentlyExecutingTask;
                 };
@@ -102,8 +107,9 @@ namespace alpaka
         public:
             //-----------------------------------------------------------------------------
             explicit QueueGenericThreadsBlocking(
-                TDev const & dev) :
-                    m_spQueueImpl(std::make_shared<generic::detail::QueueGenericThreadsBlockingImpl<TDev>>(dev))
+                TDev const & dev,
+                queue::Priority const priority = queue::Priority::Normal) :
+                    m_spQueueImpl(std::make_shared<generic::detail::QueueGenericThreadsBlockingImpl<TDev>>(dev, priority))
             {
                 ALPAKA_DEBUG_FULL_LOG_SCOPE;
 
@@ -206,7 +212,11 @@ namespace alpaka
 
                     queue.m_spQueueImpl->m_bCurrentlyExecutingTask = true;
 
-                    task();
+                    {
+                        // The kernels of the task lease their block threads from the device of this queue.
+                        dev::cpu::detail::ExecContext const context(*queue.m_spQueueImpl->m_dev.m_spDevCpuImpl, queue.m_spQueueImpl->m_priority);
+                        task();
+                    }
 
                     queue.m_spQueueImpl->m_bCurrentlyExecutingTask = false;
                 }
@@ -15,13 +15,14 @@
 #include <alpaka/wait/Traits.hpp>
 #include <alpaka/core/Unused.hpp>
 
-#include <alpaka/core/ConcurrentExecPool.hpp>
+#include <alpaka/core/StrandExecutor.hpp>
+#include <alpaka/dev/cpu/ExecContext.hpp>
+#include <alpaka/queue/Properties.hpp>
 #include <alpaka/queue/cpu/IGenericThreadsQueue.hpp>
+#include <alpaka/queue/cpu/IsCheapTask.hpp>
 
 #include <type_traits>
-#include <thread>
-#include <mutex>
-#include <future>
+#include <utility>
 
 namespace alpaka
 {
@@ -48,6 +49,10 @@ namespace alpaka
 #endif
                 //#############################################################################
                 //! The CPU device queue implementation.
+                //!
+                //! The queue does not own a thread.
+                //! Its tasks are executed in order by a strand on the executor shared by all non-blocking queues of the device.
+                //! If inline execution is enabled, cheap tasks enqueued while the queue is idle are executed by the enqueuing thread instead.
                 template<
                     typename TDev>
                 class QueueGenericThreadsNonBlockingImpl final : public IGenericThreadsQueue<TDev>
@@ -55,23 +60,16 @@ namespace alpaka
     #pragma clang diagnostic pop
 #endif
                 {
-                private:
-                    //#############################################################################
-                    using ThreadPool = alpaka::core::detail::ConcurrentExecPool<
-                        std::size_t,
-                        std::thread,                // The concurrent execution type.
-                        std::promise,               // The promise type.
-                        void,                       // The type yielding the current concurrent execution.
-                        std::mutex,                 // The mutex type to use. Only required if TisYielding is true.
-                        std::condition_variable,    // The condition variable type to use. Only required if TisYielding is true.
-                        false>;                     // If the threads should yield.
-
                 public:
                     //-----------------------------------------------------------------------------
-                    explicit QueueGenericThreadsNonBlockingImpl(
-                        TDev const & dev) :
+                    QueueGenericThreadsNonBlockingImpl(
+                        TDev const & dev,
+                        bool const bInlineWhenIdle,
+                        queue::Priority const priority) :
                             m_dev(dev),
-                            m_workerThread(1u)
+                            m_bInlineWhenIdle(bInlineWhenIdle),
+                            m_priority(priority),
+                            m_strand(m_dev.getStrandExecutor(), m_priority)
                     {}
                     //-----------------------------------------------------------------------------
                     QueueGenericThreadsNonBlockingImpl(QueueGenericThreadsNonBlockingImpl<TDev> const &) = delete;
@@ -94,49 +92,90 @@ namespace alpaka
                         wait::wait(*this, ev);
                     }
 
+// Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
+#if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
+                    //-----------------------------------------------------------------------------
+                    //! Executes the task on the calling thread if inline execution is enabled, the task is cheap and the queue is idle.
+                    //! Enqueues it into the strand otherwise.
+                    //! In both cases the kernels of the task lease their block threads from the device of this queue.
+                    //! The cost of the task is only estimated if inline execution is enabled.
+                    template<
+                        typename TTask>
+                    auto enqueueTask(
+                        TTask const & task)
+                    -> void
+                    {
+                        // The device implementation outlives the tasks because its executor joins the workers.
+                        auto taskInContext(
+                            [task, &devImpl = *m_dev.m_spDevCpuImpl, priority = m_priority]()
+                            {
+                                dev::cpu::detail::ExecContext const context(devImpl, priority);
+                                task();
+                            });
+                        if(!(m_bInlineWhenIdle && queue::isCheapTask(task) && m_strand.tryRunInline(taskInContext)))
+                        {
+                            m_strand.enqueueTask(std::move(taskInContext));
+                        }
+                    }
+#endif
+
                 public:
-                    TDev const m_dev;            //!< The device this queue is bound to.
+                    TDev const m_dev;            //!< The device this queue is bound to. It keeps the executor of the strand alive.
+                    bool const m_bInlineWhenIdle;
+                    queue::Priority const m_priority;   //!< The priority of the strand on the executor and of the kernels when they lease block threads from the device.
 
-                    ThreadPool m_workerThread;
+                    core::detail::Strand m_strand;
                 };
             }
         }
 
         //#############################################################################
         //! The CPU device queue.
+        //!
+        //! \tparam TProperty NonBlocking or NonBlockingInline.
         template<
-            typename TDev>
+            typename TDev,
+            typename TProperty = property::NonBlocking>
         class QueueGenericThreadsNonBlocking final
-            : public concepts::Implements<wait::ConceptCurrentThreadWaitFor, QueueGenericThreadsNonBlocking<TDev>>
-            , public concepts::Implements<ConceptQueue, QueueGenericThreadsNonBlocking<TDev>>
-            , public concepts::Implements<dev::ConceptGetDev, QueueGenericThreadsNonBlocking<TDev>>
+            : public concepts::Implements<wait::ConceptCurrentThreadWaitFor, QueueGenericThreadsNonBlocking<TDev, TProperty>>
+            , public concepts::Implements<ConceptQueue, QueueGenericThreadsNonBlocking<TDev, TProperty>>
+            , public concepts::Implements<dev::ConceptGetDev, QueueGenericThreadsNonBlocking<TDev, TProperty>>
         {
+            static_assert(
+                std::is_same<TProperty, property::NonBlocking>::value || std::is_same<TProperty, property::NonBlockingInline>::value,
+                "The non-blocking CPU queue only supports the NonBlocking and NonBlockingInline properties!");
+
         public:
             //-----------------------------------------------------------------------------
             explicit QueueGenericThreadsNonBlocking(
-                TDev const & dev) :
-                    m_spQueueImpl(std::make_shared<generic::detail::QueueGenericThreadsNonBlockingImpl<TDev>>(dev))
+                TDev const & dev,
+                queue::Priority const priority = queue::Priority::Normal) :
+                    m_spQueueImpl(
+                        std::make_shared<generic::detail::QueueGenericThreadsNonBlockingImpl<TDev>>(
+                            dev,
+                            std::is_same<TProperty, property::NonBlockingInline>::value,
+                            priority))
             {
                 ALPAKA_DEBUG_FULL_LOG_SCOPE;
 
                 dev.registerQueue(m_spQueueImpl);
             }
             //-----------------------------------------------------------------------------
-            QueueGenericThreadsNonBlocking(QueueGenericThreadsNonBlocking<TDev> const &) = default;
+            QueueGenericThreadsNonBlocking(QueueGenericThreadsNonBlocking<TDev, TProperty> const &) = default;
             //-----------------------------------------------------------------------------
-            QueueGenericThreadsNonBlocking(QueueGenericThreadsNonBlocking<TDev> &&) = default;
+            QueueGenericThreadsNonBlocking(QueueGenericThreadsNonBlocking<TDev, TProperty> &&) = default;
             //-----------------------------------------------------------------------------
-            auto operator=(QueueGenericThreadsNonBlocking<TDev> const &) -> QueueGenericThreadsNonBlocking<TDev> & = default;
+            auto operator=(QueueGenericThreadsNonBlocking<TDev, TProperty> const &) -> QueueGenericThreadsNonBlocking<TDev, TProperty> & = default;
             //-----------------------------------------------------------------------------
-            auto operator=(QueueGenericThreadsNonBlocking<TDev> &&) -> QueueGenericThreadsNonBlocking<TDev> & = default;
+            auto operator=(QueueGenericThreadsNonBlocking<TDev, TProperty> &&) -> QueueGenericThreadsNonBlocking<TDev, TProperty> & = default;
             //-----------------------------------------------------------------------------
-            auto operator==(QueueGenericThreadsNonBlocking<TDev> const & rhs) const
+            auto operator==(QueueGenericThreadsNonBlocking<TDev, TProperty> const & rhs) const
             -> bool
             {
                 return (m_spQueueImpl == rhs.m_spQueueImpl);
             }
             //-----------------------------------------------------------------------------
-            auto operator!=(QueueGenericThreadsNonBlocking<TDev> const & rhs) const
+            auto operator!=(QueueGenericThreadsNonBlocking<TDev, TProperty> const & rhs) const
             -> bool
             {
                 return !((*this) == rhs);
@@ -156,22 +195,24 @@ namespace alpaka
             //#############################################################################
             //! The CPU non-blocking device queue device type trait specialization.
             template<
-                typename TDev>
+                typename TDev,
+                typename TProperty>
             struct DevType<
-                queue::QueueGenericThreadsNonBlocking<TDev>>
+                queue::QueueGenericThreadsNonBlocking<TDev, TProperty>>
             {
                 using type = TDev;
             };
             //#############################################################################
             //! The CPU non-blocking device queue device get trait specialization.
             template<
-                typename TDev>
+                typename TDev,
+                typename TProperty>
             struct GetDev<
-                queue::QueueGenericThreadsNonBlocking<TDev>>
+                queue::QueueGenericThreadsNonBlocking<TDev, TProperty>>
             {
                 //-----------------------------------------------------------------------------
                 ALPAKA_FN_HOST static auto getDev(
-                    queue::QueueGenericThreadsNonBlocking<TDev> const & queue)
+                    queue::QueueGenericThreadsNonBlocking<TDev, TProperty> const & queue)
                 -> TDev
                 {
                     return queue.m_spQueueImpl->m_dev;
@@ -186,9 +227,10 @@ namespace alpaka
             //#############################################################################
             //! The CPU non-blocking device queue event type trait specialization.
             template<
-                typename TDev>
+                typename TDev,
+                typename TProperty>
             struct EventType<
-                queue::QueueGenericThreadsNonBlocking<TDev>>
+                queue::QueueGenericThreadsNonBlocking<TDev, TProperty>>
             {
                 using type = event::EventGenericThreads<TDev>;
             };
@@ -201,23 +243,24 @@ namespace alpaka
             //#############################################################################
             //! The CPU non-blocking device queue enqueue trait specialization.
             //! This default implementation for all tasks directly invokes the function call operator of the task.
+            //! With the NonBlockingInline property, cheap tasks are invoked by the calling thread while the queue is idle.
             template<
                 typename TDev,
+                typename TProperty,
                 typename TTask>
             struct Enqueue<
-                queue::QueueGenericThreadsNonBlocking<TDev>,
+                queue::QueueGenericThreadsNonBlocking<TDev, TProperty>,
                 TTask>
             {
                 //-----------------------------------------------------------------------------
                 ALPAKA_FN_HOST static auto enqueue(
-                    queue::QueueGenericThreadsNonBlocking<TDev> & queue,
+                    queue::QueueGenericThreadsNonBlocking<TDev, TProperty> & queue,
                     TTask const & task)
                 -> void
                 {
 // Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
 #if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
-                    queue.m_spQueueImpl->m_workerThread.enqueueTask(
-                        task);
+                    queue.m_spQueueImpl->enqueueTask(task);
 #else
                     alpaka::ignore_unused(queue);
                     alpaka::ignore_unused(task);
@@ -227,16 +270,17 @@ namespace alpaka
             //#############################################################################
             //! The CPU non-blocking device queue test trait specialization.
             template<
-                typename TDev>
+                typename TDev,
+                typename TProperty>
             struct Empty<
-                queue::QueueGenericThreadsNonBlocking<TDev>>
+                queue::QueueGenericThreadsNonBlocking<TDev, TProperty>>
             {
                 //-----------------------------------------------------------------------------
                 ALPAKA_FN_HOST static auto empty(
-                    queue::QueueGenericThreadsNonBlocking<TDev> const & queue)
+                    queue::QueueGenericThreadsNonBlocking<TDev, TProperty> const & queue)
                 -> bool
                 {
-                    return queue.m_spQueueImpl->m_workerThread.isIdle();
+                    return queue.m_spQueueImpl->m_strand.isIdle();
                 }
             };
         }
@@ -0,0 +1,607 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/dev/Traits.hpp>
+#include <alpaka/event/Traits.hpp>
+#include <alpaka/mem/view/Traits.hpp>
+#include <alpaka/queue/Traits.hpp>
+#include <alpaka/wait/Traits.hpp>
+#include <alpaka/core/Unused.hpp>
+
+#include <alpaka/core/StrandExecutor.hpp>
+#include <alpaka/dev/cpu/ExecContext.hpp>
+#include <alpaka/meta/ApplyTuple.hpp>
+#include <alpaka/queue/Properties.hpp>
+#include <alpaka/queue/TaskWithDependencies.hpp>
+#include <alpaka/queue/cpu/IGenericThreadsQueue.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <initializer_list>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace alpaka
+{
+    namespace event
+    {
+        template<typename TDev>
+        class EventGenericThreads;
+
+        namespace generic
+        {
+            namespace detail
+            {
+                template<typename TDev>
+                class EventGenericThreadsImpl;
+            }
+        }
+    }
+}
+
+namespace alpaka
+{
+    namespace queue
+    {
+        namespace generic
+        {
+            namespace detail
+            {
+#if BOOST_COMP_CLANG
+    // avoid diagnostic warning: "has no out-of-line virtual method definitions; its vtable will be emitted in every translation unit [-Werror,-Wweak-vtables]"
+    // https://stackoverflow.com/a/29288300
+    #pragma clang diagnostic push
+    #pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+                //#############################################################################
+                //! The CPU device out-of-order queue implementation.
+                //!
+                //! Each task is executed as soon as the tasks it depends on have been completed.
+                //! Ready tasks are executed concurrently by strands on the executor shared by all non-blocking queues of the device.
+                //! The strands are reused, so the queue only holds as many strands as tasks have been executed concurrently.
+                //! Tasks waiting for events are scheduled by the thread completing the event, so they do not block a worker while they wait.
+                template<
+                    typename TDev>
+                class QueueGenericThreadsOutOfOrderImpl final : public IGenericThreadsQueue<TDev>
+#if BOOST_COMP_CLANG
+    #pragma clang diagnostic pop
+#endif
+                {
+                public:
+                    //#############################################################################
+                    //! A task that is waiting for its dependencies or executing.
+                    struct Task
+                    {
+                        std::function<void()> m_task;
+                        std::vector<void const *> m_vpMemories;                         //!< The memory this task depends on.
+                        std::size_t m_numPendingDependencies;                           //!< The number of incomplete tasks and events this task depends on.
+                        std::vector<std::shared_ptr<Task>> m_vspSuccessors;             //!< The tasks depending on this task.
+                        typename std::list<std::shared_ptr<Task>>::iterator m_itIncomplete;
+                        bool m_bCompleted;
+                        bool m_bNotification;                                           //!< If the task is executed after it has been marked as completed.
+                    };
+
+                    //#############################################################################
+                    //! An event implementation and the enqueue operation of it a task waits for.
+                    using EventDependency = std::pair<std::shared_ptr<event::generic::detail::EventGenericThreadsImpl<TDev>>, std::size_t>;
+
+                    //-----------------------------------------------------------------------------
+                    QueueGenericThreadsOutOfOrderImpl(
+                        TDev const & dev,
+                        queue::Priority const priority) :
+                            m_dev(dev),
+                            m_priority(priority)
+                    {}
+                    //-----------------------------------------------------------------------------
+                    QueueGenericThreadsOutOfOrderImpl(QueueGenericThreadsOutOfOrderImpl<TDev> const &) = delete;
+                    //-----------------------------------------------------------------------------
+                    QueueGenericThreadsOutOfOrderImpl(QueueGenericThreadsOutOfOrderImpl<TDev> &&) = delete;
+                    //-----------------------------------------------------------------------------
+                    auto operator=(QueueGenericThreadsOutOfOrderImpl<TDev> const &) -> QueueGenericThreadsOutOfOrderImpl<TDev> & = delete;
+                    //-----------------------------------------------------------------------------
+                    auto operator=(QueueGenericThreadsOutOfOrderImpl<TDev> &&) -> QueueGenericThreadsOutOfOrderImpl<TDev> & = delete;
+                    //-----------------------------------------------------------------------------
+                    //! Completes all enqueued tasks because they may depend on each other.
+                    ~QueueGenericThreadsOutOfOrderImpl()
+                    {
+                        core::detail::StrandExecutor::BlockingScope const blocking;
+                        std::unique_lock<std::mutex> lk(m_mutex);
+                        m_cvCompleted.wait(lk, [this](){return m_lspIncompleteTasks.empty();});
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    void enqueue(event::EventGenericThreads<TDev> & ev) final
+                    {
+                        queue::enqueue(*this, ev);
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    void wait(event::EventGenericThreads<TDev> const & ev) final
+                    {
+                        wait::wait(*this, ev);
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    //! Enqueues a task that is executed after the given events and after all tasks enqueued before that depend on the same memory.
+                    auto enqueueTask(
+                        std::function<void()> task,
+                        std::vector<void const *> vpMemories,
+                        std::vector<EventDependency> const & vEventDependencies)
+                    -> void
+                    {
+                        std::lock_guard<std::mutex> lk(m_mutex);
+
+                        auto spTask(createTask(std::move(task)));
+                        for(auto const & eventDependency : vEventDependencies)
+                        {
+                            addEventDependency(spTask, eventDependency);
+                        }
+
+                        // Depending twice on the same memory would let the task wait for itself.
+                        std::sort(vpMemories.begin(), vpMemories.end());
+                        vpMemories.erase(std::unique(vpMemories.begin(), vpMemories.end()), vpMemories.end());
+                        for(auto const pMemory : vpMemories)
+                        {
+                            auto & spLastTask(m_mapLastTaskPerMemory[pMemory]);
+                            addDependency(spTask, spLastTask);
+                            spLastTask = spTask;
+                        }
+                        spTask->m_vpMemories = std::move(vpMemories);
+
+                        scheduleIfReady(spTask);
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Enqueues a notification that is executed after all tasks enqueued before.
+                    //! The queue is empty as soon as the notification is executed, so waiting for the notification implies that the queue is empty.
+                    auto enqueueNotification(
+                        std::function<void()> task)
+                    -> void
+                    {
+                        std::lock_guard<std::mutex> lk(m_mutex);
+
+                        auto spTask(createTask(std::move(task)));
+                        spTask->m_bNotification = true;
+                        for(auto const & spIncompleteTask : m_lspIncompleteTasks)
+                        {
+                            if(spIncompleteTask != spTask)
+                            {
+                                addDependency(spTask, spIncompleteTask);
+                            }
+                        }
+
+                        scheduleIfReady(spTask);
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Lets all tasks enqueued later wait for the given event.
+                    auto enqueueEventGate(
+                        EventDependency const & eventDependency)
+                    -> void
+                    {
+                        std::lock_guard<std::mutex> lk(m_mutex);
+
+                        // The new gate depends on the previous one, so all tasks enqueued later only have to depend on the new one.
+                        auto spTask(createTask(nullptr));
+                        m_spGate = spTask;
+                        addEventDependency(spTask, eventDependency);
+
+                        scheduleIfReady(spTask);
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return If all tasks have been completed.
+                    auto empty() const
+                    -> bool
+                    {
+                        std::lock_guard<std::mutex> lk(m_mutex);
+
+                        return m_lspIncompleteTasks.empty();
+                    }
+
+                private:
+                    //-----------------------------------------------------------------------------
+                    //! \return A new incomplete task depending on the current gate.
+                    auto createTask(
+                        std::function<void()> task)
+                    -> std::shared_ptr<Task>
+                    {
+                        auto spTask(std::make_shared<Task>());
+                        spTask->m_task = std::move(task);
+                        spTask->m_numPendingDependencies = 0u;
+                        spTask->m_bCompleted = false;
+                        spTask->m_bNotification = false;
+                        spTask->m_itIncomplete = m_lspIncompleteTasks.insert(m_lspIncompleteTasks.end(), spTask);
+
+                        addDependency(spTask, m_spGate);
+
+                        return spTask;
+                    }
+                    //-----------------------------------------------------------------------------
+                    static auto addDependency(
+                        std::shared_ptr<Task> const & spTask,
+                        std::shared_ptr<Task> const & spPredecessor)
+                    -> void
+                    {
+                        if(spPredecessor && !spPredecessor->m_bCompleted)
+                        {
+                            ++spTask->m_numPendingDependencies;
+                            spPredecessor->m_vspSuccessors.push_back(spTask);
+                        }
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Lets the task wait for the event. The mutex has to be locked.
+                    auto addEventDependency(
+                        std::shared_ptr<Task> const & spTask,
+                        EventDependency const & eventDependency)
+                    -> void
+                    {
+                        // The continuation locks the mutex, so it can not resolve the dependency before it has been counted.
+                        ++spTask->m_numPendingDependencies;
+                        if(!eventDependency.first->addContinuation(
+                            eventDependency.second,
+                            [this, spTask]()
+                            {
+                                resolveEventDependency(spTask);
+                            }))
+                        {
+                            --spTask->m_numPendingDependencies;
+                        }
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Called by the thread completing an event the task waits for.
+                    auto resolveEventDependency(
+                        std::shared_ptr<Task> const & spTask)
+                    -> void
+                    {
+                        std::lock_guard<std::mutex> lk(m_mutex);
+
+                        --spTask->m_numPendingDependencies;
+                        scheduleIfReady(spTask);
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Executes the task on an idle strand if it does not depend on incomplete tasks. The mutex has to be locked.
+                    //! Tasks without a function only order other tasks, so they are completed right away.
+                    auto scheduleIfReady(
+                        std::shared_ptr<Task> const & spTask)
+                    -> void
+                    {
+                        if(spTask->m_numPendingDependencies != 0u)
+                        {
+                            return;
+                        }
+                        if(!spTask->m_task)
+                        {
+                            completeLocked(spTask, nullptr);
+                            return;
+                        }
+
+                        core::detail::Strand * pStrand(nullptr);
+                        if(m_vpIdleStrands.empty())
+                        {
+                            m_vupStrands.emplace_back(std::make_unique<core::detail::Strand>(m_dev.getStrandExecutor(), m_priority));
+                            pStrand = m_vupStrands.back().get();
+                        }
+                        else
+                        {
+                            pStrand = m_vpIdleStrands.back();
+                            m_vpIdleStrands.pop_back();
+                        }
+
+// Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
+#if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
+                        pStrand->enqueueTask(
+                            [this, spTask, pStrand]()
+                            {
+                                // The kernels of the task lease their block threads from the device of this queue.
+                                dev::cpu::detail::ExecContext const context(*m_dev.m_spDevCpuImpl, m_priority);
+
+                                if(spTask->m_bNotification)
+                                {
+                                    // Only later notifications depend on a notification, so they may be executed concurrently.
+                                    auto const task(std::move(spTask->m_task));
+                                    complete(spTask, *pStrand);
+                                    task();
+                                    return;
+                                }
+
+                                try
+                                {
+                                    spTask->m_task();
+                                }
+                                catch(...)
+                                {
+                                    complete(spTask, *pStrand);
+                                    throw;
+                                }
+                                complete(spTask, *pStrand);
+                            });
+#endif
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Schedules the successors of the task completed by the given strand.
+                    auto complete(
+                        std::shared_ptr<Task> const & spTask,
+                        core::detail::Strand & strand)
+                    -> void
+                    {
+                        std::lock_guard<std::mutex> lk(m_mutex);
+
+                        completeLocked(spTask, &strand);
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Schedules the successors of the completed task. The mutex has to be locked.
+                    //! \param pStrand The strand that executed the task or nullptr if it has not been executed by a strand.
+                    auto completeLocked(
+                        std::shared_ptr<Task> const & spTask,
+                        core::detail::Strand * const pStrand)
+                    -> void
+                    {
+                        spTask->m_bCompleted = true;
+                        // Release the resources captured by the task.
+                        spTask->m_task = nullptr;
+                        for(auto const pMemory : spTask->m_vpMemories)
+                        {
+                            auto const itLastTask(m_mapLastTaskPerMemory.find(pMemory));
+                            if(itLastTask != m_mapLastTaskPerMemory.end() && itLastTask->second == spTask)
+                            {
+                                m_mapLastTaskPerMemory.erase(itLastTask);
+                            }
+                        }
+                        if(m_spGate == spTask)
+                        {
+                            m_spGate.reset();
+                        }
+
+                        // The strand is only executing the remainder of this task, so a successor can already be enqueued into it.
+                        if(pStrand)
+                        {
+                            m_vpIdleStrands.push_back(pStrand);
+                        }
+                        auto const vspSuccessors(std::move(spTask->m_vspSuccessors));
+                        for(auto const & spSuccessor : vspSuccessors)
+                        {
+                            --spSuccessor->m_numPendingDependencies;
+                            scheduleIfReady(spSuccessor);
+                        }
+
+                        m_lspIncompleteTasks.erase(spTask->m_itIncomplete);
+                        if(m_lspIncompleteTasks.empty())
+                        {
+                            // Notify while holding the lock because the destructor may destroy the condition variable as soon as it observes the empty queue.
+                            m_cvCompleted.notify_all();
+                        }
+                    }
+
+                public:
+                    TDev const m_dev;            //!< The device this queue is bound to. It keeps the executor of the strands alive.
+                    queue::Priority const m_priority;   //!< The priority of the strands on the executor and of the kernels when they lease block threads from the device.
+
+                private:
+                    std::mutex mutable m_mutex;
+                    std::condition_variable m_cvCompleted;
+                    std::list<std::shared_ptr<Task>> m_lspIncompleteTasks;
+                    std::map<void const *, std::shared_ptr<Task>> m_mapLastTaskPerMemory;  //!< The last incomplete task depending on the memory.
+                    std::shared_ptr<Task> m_spGate;                                         //!< The last incomplete task all tasks enqueued later depend on.
+                    std::vector<core::detail::Strand *> m_vpIdleStrands;
+                    std::vector<std::unique_ptr<core::detail::Strand>> m_vupStrands;
+                };
+            }
+        }
+
+        //#############################################################################
+        //! The CPU device out-of-order queue.
+        //!
+        //! Tasks enqueued into this queue may be executed concurrently and in any order.
+        //! Use queue::dependsOn to order a task after the events and after the tasks enqueued before that access the same memory.
+        //! Memory views are identified by their native pointer, so overlapping sub-views are not detected.
+        //! Enqueued events and wait::wait(queue) still wait for all tasks enqueued before, waiting for an event delays all tasks enqueued later.
+        template<
+            typename TDev>
+        class QueueGenericThreadsOutOfOrder final
+            : public concepts::Implements<wait::ConceptCurrentThreadWaitFor, QueueGenericThreadsOutOfOrder<TDev>>
+            , public concepts::Implements<ConceptQueue, QueueGenericThreadsOutOfOrder<TDev>>
+            , public concepts::Implements<dev::ConceptGetDev, QueueGenericThreadsOutOfOrder<TDev>>
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            explicit QueueGenericThreadsOutOfOrder(
+                TDev const & dev,
+                queue::Priority const priority = queue::Priority::Normal) :
+                    m_spQueueImpl(std::make_shared<generic::detail::QueueGenericThreadsOutOfOrderImpl<TDev>>(dev, priority))
+            {
+                ALPAKA_DEBUG_FULL_LOG_SCOPE;
+
+                dev.registerQueue(m_spQueueImpl);
+            }
+            //-----------------------------------------------------------------------------
+            QueueGenericThreadsOutOfOrder(QueueGenericThreadsOutOfOrder<TDev> const &) = default;
+            //-----------------------------------------------------------------------------
+            QueueGenericThreadsOutOfOrder(QueueGenericThreadsOutOfOrder<TDev> &&) = default;
+            //-----------------------------------------------------------------------------
+            auto operator=(QueueGenericThreadsOutOfOrder<TDev> const &) -> QueueGenericThreadsOutOfOrder<TDev> & = default;
+            //-----------------------------------------------------------------------------
+            auto operator=(QueueGenericThreadsOutOfOrder<TDev> &&) -> QueueGenericThreadsOutOfOrder<TDev> & = default;
+            //-----------------------------------------------------------------------------
+            auto operator==(QueueGenericThreadsOutOfOrder<TDev> const & rhs) const
+            -> bool
+            {
+                return (m_spQueueImpl == rhs.m_spQueueImpl);
+            }
+            //-----------------------------------------------------------------------------
+            auto operator!=(QueueGenericThreadsOutOfOrder<TDev> const & rhs) const
+            -> bool
+            {
+                return !((*this) == rhs);
+            }
+            //-----------------------------------------------------------------------------
+            ~QueueGenericThreadsOutOfOrder() = default;
+
+        public:
+            std::shared_ptr<generic::detail::QueueGenericThreadsOutOfOrderImpl<TDev>> m_spQueueImpl;
+        };
+    }
+
+    namespace dev
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU out-of-order device queue device type trait specialization.
+            template<
+                typename TDev>
+            struct DevType<
+                queue::QueueGenericThreadsOutOfOrder<TDev>>
+            {
+                using type = TDev;
+            };
+            //#############################################################################
+            //! The CPU out-of-order device queue device get trait specialization.
+            template<
+                typename TDev>
+            struct GetDev<
+                queue::QueueGenericThreadsOutOfOrder<TDev>>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto getDev(
+                    queue::QueueGenericThreadsOutOfOrder<TDev> const & queue)
+                -> TDev
+                {
+                    return queue.m_spQueueImpl->m_dev;
+                }
+            };
+        }
+    }
+    namespace event
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU out-of-order device queue event type trait specialization.
+            template<
+                typename TDev>
+            struct EventType<
+                queue::QueueGenericThreadsOutOfOrder<TDev>>
+            {
+                using type = event::EventGenericThreads<TDev>;
+            };
+        }
+    }
+    namespace queue
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU out-of-order device queue enqueue trait specialization.
+            //! This default implementation for all tasks executes the function call operator of the task without any dependencies.
+            template<
+                typename TDev,
+                typename TTask>
+            struct Enqueue<
+                queue::QueueGenericThreadsOutOfOrder<TDev>,
+                TTask>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto enqueue(
+                    queue::QueueGenericThreadsOutOfOrder<TDev> & queue,
+                    TTask const & task)
+                -> void
+                {
+                    queue.m_spQueueImpl->enqueueTask(
+                        task,
+                        {},
+                        {});
+                }
+            };
+            //#############################################################################
+            //! The CPU out-of-order device queue enqueue trait specialization for tasks with dependencies.
+            //! Kernel tasks need no specialization of their own, they lease their block threads via the execution context set by the strand executing them.
+            template<
+                typename TDev,
+                typename TTask,
+                typename... TDependencies>
+            struct Enqueue<
+                queue::QueueGenericThreadsOutOfOrder<TDev>,
+                queue::TaskWithDependencies<TTask, TDependencies...>>
+            {
+                using QueueImpl = generic::detail::QueueGenericThreadsOutOfOrderImpl<TDev>;
+
+                //#############################################################################
+                //! Collects the memory and the events a task depends on.
+                struct DependencyCollector
+                {
+                    //-----------------------------------------------------------------------------
+                    auto operator()(
+                        event::EventGenericThreads<TDev> const & event)
+                    -> void
+                    {
+                        auto const enqueueCount = event.m_spEventImpl->m_enqueueCount.load();
+                        if(!event.m_spEventImpl->isReady(enqueueCount))
+                        {
+                            m_vEventDependencies.emplace_back(event.m_spEventImpl, enqueueCount);
+                        }
+                    }
+                    //-----------------------------------------------------------------------------
+                    template<
+                        typename TView>
+                    auto operator()(
+                        TView const & view)
+                    -> void
+                    {
+                        m_vpMemories.push_back(static_cast<void const *>(mem::view::getPtrNative(view)));
+                    }
+
+                    std::vector<void const *> m_vpMemories;
+                    std::vector<typename QueueImpl::EventDependency> m_vEventDependencies;
+                };
+
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto enqueue(
+                    queue::QueueGenericThreadsOutOfOrder<TDev> & queue,
+                    queue::TaskWithDependencies<TTask, TDependencies...> const & task)
+                -> void
+                {
+                    DependencyCollector collector{{}, {}};
+                    meta::apply(
+                        [&collector](auto const & ... dependencies)
+                        {
+                            alpaka::ignore_unused(std::initializer_list<int>{(collector(dependencies), 0)...});
+                        },
+                        task.m_dependencies);
+
+                    queue.m_spQueueImpl->enqueueTask(
+                        task.m_task,
+                        std::move(collector.m_vpMemories),
+                        collector.m_vEventDependencies);
+                }
+            };
+            //#############################################################################
+            //! The CPU out-of-order device queue test trait specialization.
+            template<
+                typename TDev>
+            struct Empty<
+                queue::QueueGenericThreadsOutOfOrder<TDev>>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto empty(
+                    queue::QueueGenericThreadsOutOfOrder<TDev> const & queue)
+                -> bool
+                {
+                    return queue.m_spQueueImpl->empty();
+                }
+            };
+        }
+    }
+}
+
+#include <alpaka/event/EventGenericThreads.hpp>
@@ -0,0 +1,60 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>
+
+#include <tuple>
+
+namespace alpaka
+{
+    namespace queue
+    {
+        //#############################################################################
+        //! A task together with the memory views and events it depends on.
+        //!
+        //! Out-of-order queues execute the task after the given events and after all tasks enqueued before that depend on the same memory.
+        //! In-order queues do not accept it because they can not honor the event dependencies without blocking.
+        template<
+            typename TTask,
+            typename... TDependencies>
+        class TaskWithDependencies final
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            TaskWithDependencies(
+                TTask const & task,
+                TDependencies const & ... dependencies) :
+                    m_task(task),
+                    m_dependencies(dependencies...)
+            {}
+
+        public:
+            TTask m_task;
+            std::tuple<TDependencies...> m_dependencies;
+        };
+
+        //-----------------------------------------------------------------------------
+        //! \return The task depending on the given memory views and events.
+        template<
+            typename TTask,
+            typename... TDependencies>
+        ALPAKA_FN_HOST auto dependsOn(
+            TTask const & task,
+            TDependencies const & ... dependencies)
+        -> TaskWithDependencies<TTask, TDependencies...>
+        {
+            return
+                TaskWithDependencies<TTask, TDependencies...>(
+                    task,
+                    dependencies...);
+        }
+    }
+}
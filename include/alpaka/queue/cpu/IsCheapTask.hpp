@@ -0,0 +1,88 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Concepts.hpp>
+#include <alpaka/core/Positioning.hpp>
+#include <alpaka/workdiv/Traits.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+//-----------------------------------------------------------------------------
+//! The maximum number of grid elements of a kernel task which is still estimated to be cheap.
+#ifndef ALPAKA_CPU_QUEUE_INLINE_MAX_ELEMS
+    #define ALPAKA_CPU_QUEUE_INLINE_MAX_ELEMS 256
+#endif
+
+namespace alpaka
+{
+    namespace queue
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The cheap task estimation trait.
+            //!
+            //! Cheap tasks may be executed by the thread enqueuing them into an idle queue with the NonBlockingInline property.
+            //! Nothing is known about the cost of arbitrary tasks, so they are not cheap by default.
+            //! Specialize this trait to mark other tasks as cheap.
+            template<
+                typename TTask,
+                typename TSfinae = void>
+            struct IsCheapTask
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto isCheapTask(
+                    TTask const &)
+                -> bool
+                {
+                    return false;
+                }
+            };
+            //#############################################################################
+            //! The cheap task estimation trait specialization for tasks with a work division, e.g. kernel tasks.
+            //!
+            //! The work per element is unknown, so the task is estimated by its number of grid elements.
+            template<
+                typename TTask>
+            struct IsCheapTask<
+                TTask,
+                std::enable_if_t<concepts::ImplementsConcept<workdiv::ConceptWorkDiv, TTask>::value>>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto isCheapTask(
+                    TTask const & task)
+                -> bool
+                {
+                    return
+                        static_cast<std::size_t>(workdiv::getWorkDiv<Grid, Elems>(task).prod())
+                        <= static_cast<std::size_t>(ALPAKA_CPU_QUEUE_INLINE_MAX_ELEMS);
+                }
+            };
+        }
+
+        //-----------------------------------------------------------------------------
+        //! \return If the task is estimated to be cheap enough to be executed by the thread enqueuing it.
+        template<
+            typename TTask>
+        ALPAKA_FN_HOST auto isCheapTask(
+            TTask const & task)
+        -> bool
+        {
+            return
+                traits::IsCheapTask<
+                    TTask>
+                ::isCheapTask(
+                    task);
+        }
+    }
+}
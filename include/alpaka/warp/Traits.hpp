@@ -61,6 +61,41 @@ namespace alpaka
                 typename TWarp,
                 typename TSfinae = void>
             struct Activemask;
+
+            //#############################################################################
+            //! The lane index trait.
+            template<
+                typename TWarp,
+                typename TSfinae = void>
+            struct GetLaneIdx;
+
+            //#############################################################################
+            //! The shuffle from an indexed lane trait.
+            template<
+                typename TWarp,
+                typename TSfinae = void>
+            struct Shfl;
+
+            //#############################################################################
+            //! The shuffle from a lane with lower index trait.
+            template<
+                typename TWarp,
+                typename TSfinae = void>
+            struct ShflUp;
+
+            //#############################################################################
+            //! The shuffle from a lane with higher index trait.
+            template<
+                typename TWarp,
+                typename TSfinae = void>
+            struct ShflDown;
+
+            //#############################################################################
+            //! The shuffle from the lane with the index xor the lane mask trait.
+            template<
+                typename TWarp,
+                typename TSfinae = void>
+            struct ShflXor;
         }
 
         //-----------------------------------------------------------------------------
@@ -196,5 +231,230 @@ namespace alpaka
                 warp,
                 predicate);
         }
+
+        //-----------------------------------------------------------------------------
+        //! Returns the index of the calling thread within its warp.
+        //!
+        //! \tparam TWarp The warp implementation type.
+        //! \param warp The warp implementation.
+        ALPAKA_NO_HOST_ACC_WARNING
+        template<
+            typename TWarp>
+        ALPAKA_FN_ACC auto getLaneIdx(
+            TWarp const & warp)
+        -> std::int32_t
+        {
+            using ImplementationBase = concepts::ImplementationBase<ConceptWarp, TWarp>;
+            return traits::GetLaneIdx<
+                ImplementationBase>
+            ::getLaneIdx(
+                warp);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Exchanges a value between the threads of a warp without going through shared memory.
+        //!
+        //! It follows the logic of __shfl(value, srcLane) in CUDA before version 9.0 and HIP for the whole warp.
+        //! The modern CUDA counterpart would be __shfl_sync(__activemask(), value, srcLane).
+        //! All threads of the warp have to participate.
+        //!
+        //! \tparam TWarp The warp implementation type.
+        //! \param warp The warp implementation.
+        //! \param value The value of the current thread.
+        //! \param srcLane The lane to read the value from. It is taken modulo the warp size.
+        //! \return The value of the thread in lane srcLane.
+        ALPAKA_NO_HOST_ACC_WARNING
+        template<
+            typename TWarp,
+            typename T>
+        ALPAKA_FN_ACC auto shfl(
+            TWarp const & warp,
+            T const & value,
+            std::int32_t srcLane)
+        -> T
+        {
+            using ImplementationBase = concepts::ImplementationBase<ConceptWarp, TWarp>;
+            return traits::Shfl<
+                ImplementationBase>
+            ::shfl(
+                warp,
+                value,
+                srcLane);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Returns the value of the thread delta lanes below the current one.
+        //! The threads in the lanes below delta keep their own value.
+        //!
+        //! It follows the logic of __shfl_up(value, delta) in CUDA before version 9.0 and HIP for the whole warp.
+        //! All threads of the warp have to participate.
+        //!
+        //! \tparam TWarp The warp implementation type.
+        //! \param warp The warp implementation.
+        //! \param value The value of the current thread.
+        //! \param delta The distance to the source lane.
+        ALPAKA_NO_HOST_ACC_WARNING
+        template<
+            typename TWarp,
+            typename T>
+        ALPAKA_FN_ACC auto shflUp(
+            TWarp const & warp,
+            T const & value,
+            std::uint32_t delta)
+        -> T
+        {
+            using ImplementationBase = concepts::ImplementationBase<ConceptWarp, TWarp>;
+            return traits::ShflUp<
+                ImplementationBase>
+            ::shflUp(
+                warp,
+                value,
+                delta);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Returns the value of the thread delta lanes above the current one.
+        //! The threads in the upper delta lanes keep their own value.
+        //!
+        //! It follows the logic of __shfl_down(value, delta) in CUDA before version 9.0 and HIP for the whole warp.
+        //! All threads of the warp have to participate.
+        //!
+        //! \tparam TWarp The warp implementation type.
+        //! \param warp The warp implementation.
+        //! \param value The value of the current thread.
+        //! \param delta The distance to the source lane.
+        ALPAKA_NO_HOST_ACC_WARNING
+        template<
+            typename TWarp,
+            typename T>
+        ALPAKA_FN_ACC auto shflDown(
+            TWarp const & warp,
+            T const & value,
+            std::uint32_t delta)
+        -> T
+        {
+            using ImplementationBase = concepts::ImplementationBase<ConceptWarp, TWarp>;
+            return traits::ShflDown<
+                ImplementationBase>
+            ::shflDown(
+                warp,
+                value,
+                delta);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Returns the value of the thread in the lane given by the index of the current lane xor laneMask.
+        //!
+        //! It follows the logic of __shfl_xor(value, laneMask) in CUDA before version 9.0 and HIP for the whole warp.
+        //! All threads of the warp have to participate.
+        //!
+        //! \tparam TWarp The warp implementation type.
+        //! \param warp The warp implementation.
+        //! \param value The value of the current thread.
+        //! \param laneMask The mask combined with the index of the current lane.
+        ALPAKA_NO_HOST_ACC_WARNING
+        template<
+            typename TWarp,
+            typename T>
+        ALPAKA_FN_ACC auto shflXor(
+            TWarp const & warp,
+            T const & value,
+            std::int32_t laneMask)
+        -> T
+        {
+            using ImplementationBase = concepts::ImplementationBase<ConceptWarp, TWarp>;
+            return traits::ShflXor<
+                ImplementationBase>
+            ::shflXor(
+                warp,
+                value,
+                laneMask);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Combines the values of all threads of a warp with a butterfly of shuffles.
+        //!
+        //! All threads of the warp have to participate and all of them receive the result.
+        //!
+        //! \tparam TWarp The warp implementation type.
+        //! \param warp The warp implementation.
+        //! \param value The value of the current thread.
+        //! \param op The associative and commutative binary operation.
+        ALPAKA_NO_HOST_ACC_WARNING
+        template<
+            typename TWarp,
+            typename T,
+            typename TOp>
+        ALPAKA_FN_ACC auto reduce(
+            TWarp const & warp,
+            T value,
+            TOp const & op)
+        -> T
+        {
+            for(std::int32_t laneMask(getSize(warp) / 2); laneMask > 0; laneMask /= 2)
+            {
+                value = op(value, shflXor(warp, value, laneMask));
+            }
+            return value;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Combines the values of the threads up to and including the current one in lane order.
+        //!
+        //! All threads of the warp have to participate.
+        //!
+        //! \tparam TWarp The warp implementation type.
+        //! \param warp The warp implementation.
+        //! \param value The value of the current thread.
+        //! \param op The associative binary operation.
+        ALPAKA_NO_HOST_ACC_WARNING
+        template<
+            typename TWarp,
+            typename T,
+            typename TOp>
+        ALPAKA_FN_ACC auto inclusiveScan(
+            TWarp const & warp,
+            T value,
+            TOp const & op)
+        -> T
+        {
+            auto const laneIdx(getLaneIdx(warp));
+            for(std::int32_t delta(1); delta < getSize(warp); delta *= 2)
+            {
+                auto const lowerValue(shflUp(warp, value, static_cast<std::uint32_t>(delta)));
+                if(laneIdx >= delta)
+                {
+                    value = op(lowerValue, value);
+                }
+            }
+            return value;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Combines the values of the threads before the current one in lane order.
+        //!
+        //! All threads of the warp have to participate.
+        //!
+        //! \tparam TWarp The warp implementation type.
+        //! \param warp The warp implementation.
+        //! \param value The value of the current thread.
+        //! \param op The associative binary operation.
+        //! \param identity The identity of op which is returned to the first lane.
+        ALPAKA_NO_HOST_ACC_WARNING
+        template<
+            typename TWarp,
+            typename T,
+            typename TOp>
+        ALPAKA_FN_ACC auto exclusiveScan(
+            TWarp const & warp,
+            T const & value,
+            TOp const & op,
+            T const & identity)
+        -> T
+        {
+            auto const inclusive(inclusiveScan(warp, value, op));
+            auto const exclusive(shflUp(warp, inclusive, 1u));
+            return (getLaneIdx(warp) == 0) ? identity : exclusive;
+        }
     }
 }
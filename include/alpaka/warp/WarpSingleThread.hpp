@@ -105,6 +105,92 @@ namespace alpaka
                     return predicate ? 1u : 0u;
                 }
             };
+
+            //#############################################################################
+            template<>
+            struct GetLaneIdx<
+                WarpSingleThread>
+            {
+                //-----------------------------------------------------------------------------
+                static auto getLaneIdx(
+                    warp::WarpSingleThread const & /*warp*/)
+                -> std::int32_t
+                {
+                    return 0;
+                }
+            };
+
+            //#############################################################################
+            template<>
+            struct Shfl<
+                WarpSingleThread>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename T>
+                static auto shfl(
+                    warp::WarpSingleThread const & /*warp*/,
+                    T const & value,
+                    std::int32_t /*srcLane*/)
+                -> T
+                {
+                    return value;
+                }
+            };
+
+            //#############################################################################
+            template<>
+            struct ShflUp<
+                WarpSingleThread>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename T>
+                static auto shflUp(
+                    warp::WarpSingleThread const & /*warp*/,
+                    T const & value,
+                    std::uint32_t /*delta*/)
+                -> T
+                {
+                    return value;
+                }
+            };
+
+            //#############################################################################
+            template<>
+            struct ShflDown<
+                WarpSingleThread>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename T>
+                static auto shflDown(
+                    warp::WarpSingleThread const & /*warp*/,
+                    T const & value,
+                    std::uint32_t /*delta*/)
+                -> T
+                {
+                    return value;
+                }
+            };
+
+            //#############################################################################
+            template<>
+            struct ShflXor<
+                WarpSingleThread>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename T>
+                static auto shflXor(
+                    warp::WarpSingleThread const & /*warp*/,
+                    T const & value,
+                    std::int32_t /*laneMask*/)
+                -> T
+                {
+                    return value;
+                }
+            };
         }
     }
 }
@@ -164,6 +164,130 @@ namespace alpaka
 #else
                     ignore_unused(warp);
                     return __ballot(predicate);
+#endif
+                }
+            };
+
+            //#############################################################################
+            template<>
+            struct GetLaneIdx<
+                WarpUniformCudaHipBuiltIn>
+            {
+                //-----------------------------------------------------------------------------
+                __device__ static auto getLaneIdx(
+                    warp::WarpUniformCudaHipBuiltIn const & /*warp*/)
+                    -> std::int32_t
+                {
+#if defined(ALPAKA_ACC_GPU_CUDA_ENABLED)
+                    std::int32_t laneIdx;
+                    asm volatile("mov.s32 %0, %%laneid;" : "=r"(laneIdx));
+                    return laneIdx;
+#else
+                    return static_cast<std::int32_t>(__lane_id());
+#endif
+                }
+            };
+
+            //#############################################################################
+            template<>
+            struct Shfl<
+                WarpUniformCudaHipBuiltIn>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename T>
+                __device__ static auto shfl(
+                    warp::WarpUniformCudaHipBuiltIn const & warp,
+                    T const & value,
+                    std::int32_t srcLane)
+                    -> T
+                {
+#if defined(ALPAKA_ACC_GPU_CUDA_ENABLED)
+                    return __shfl_sync(
+                        activemask(warp),
+                        value,
+                        srcLane);
+#else
+                    ignore_unused(warp);
+                    return __shfl(value, srcLane);
+#endif
+                }
+            };
+
+            //#############################################################################
+            template<>
+            struct ShflUp<
+                WarpUniformCudaHipBuiltIn>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename T>
+                __device__ static auto shflUp(
+                    warp::WarpUniformCudaHipBuiltIn const & warp,
+                    T const & value,
+                    std::uint32_t delta)
+                    -> T
+                {
+#if defined(ALPAKA_ACC_GPU_CUDA_ENABLED)
+                    return __shfl_up_sync(
+                        activemask(warp),
+                        value,
+                        delta);
+#else
+                    ignore_unused(warp);
+                    return __shfl_up(value, delta);
+#endif
+                }
+            };
+
+            //#############################################################################
+            template<>
+            struct ShflDown<
+                WarpUniformCudaHipBuiltIn>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename T>
+                __device__ static auto shflDown(
+                    warp::WarpUniformCudaHipBuiltIn const & warp,
+                    T const & value,
+                    std::uint32_t delta)
+                    -> T
+                {
+#if defined(ALPAKA_ACC_GPU_CUDA_ENABLED)
+                    return __shfl_down_sync(
+                        activemask(warp),
+                        value,
+                        delta);
+#else
+                    ignore_unused(warp);
+                    return __shfl_down(value, delta);
+#endif
+                }
+            };
+
+            //#############################################################################
+            template<>
+            struct ShflXor<
+                WarpUniformCudaHipBuiltIn>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename T>
+                __device__ static auto shflXor(
+                    warp::WarpUniformCudaHipBuiltIn const & warp,
+                    T const & value,
+                    std::int32_t laneMask)
+                    -> T
+                {
+#if defined(ALPAKA_ACC_GPU_CUDA_ENABLED)
+                    return __shfl_xor_sync(
+                        activemask(warp),
+                        value,
+                        laneMask);
+#else
+                    ignore_unused(warp);
+                    return __shfl_xor(value, laneMask);
 #endif
                 }
             };
@@ -94,6 +94,11 @@ else
     # If the variable is not set, the backend will most probably be used by default so we install it.
     export ALPAKA_CI_INSTALL_FIBERS="ON"
 fi
+# The lanes back-end requires the same compiled boost libraries as the fibers back-end.
+if [ "${ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLE:-OFF}" = "ON" ]
+then
+    export ALPAKA_CI_INSTALL_FIBERS="ON"
+fi
 
 
 # GCC-5.5 has broken avx512vlintrin.h in Release mode with NVCC 9.X
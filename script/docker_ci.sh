@@ -49,6 +49,14 @@ if [ ! -z "${ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE+x}" ]
 then
     ALPAKA_DOCKER_ENV_LIST+=("--env" "ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE=${ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE}")
 fi
+if [ ! -z "${ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLE+x}" ]
+then
+    ALPAKA_DOCKER_ENV_LIST+=("--env" "ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLE=${ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLE}")
+fi
+if [ ! -z "${ALPAKA_CPU_WORK_STEALING+x}" ]
+then
+    ALPAKA_DOCKER_ENV_LIST+=("--env" "ALPAKA_CPU_WORK_STEALING=${ALPAKA_CPU_WORK_STEALING}")
+fi
 if [ ! -z "${ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLE+x}" ]
 then
     ALPAKA_DOCKER_ENV_LIST+=("--env" "ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLE=${ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLE}")
@@ -75,6 +75,17 @@ namespace alpaka
                     typename TIdx>
                 using AccCpuFibersIfAvailableElseInt = int;
 #endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_LANES_ENABLED)
+                template<
+                    typename TDim,
+                    typename TIdx>
+                using AccCpuLanesIfAvailableElseInt = alpaka::acc::AccCpuLanes<TDim, TIdx>;
+#else
+                template<
+                    typename TDim,
+                    typename TIdx>
+                using AccCpuLanesIfAvailableElseInt = int;
+#endif
 #if defined(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED)
                 template<
                     typename TDim,
@@ -167,6 +178,7 @@ namespace alpaka
                         AccCpuSerialIfAvailableElseInt<TDim, TIdx>,
                         AccCpuThreadsIfAvailableElseInt<TDim, TIdx>,
                         AccCpuFibersIfAvailableElseInt<TDim, TIdx>,
+                        AccCpuLanesIfAvailableElseInt<TDim, TIdx>,
                         AccCpuTbbIfAvailableElseInt<TDim, TIdx>,
                         AccCpuOmp2BlocksIfAvailableElseInt<TDim, TIdx>,
                         AccCpuOmp2ThreadsIfAvailableElseInt<TDim, TIdx>,
@@ -0,0 +1,83 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/atomic/AtomicBlockAggregator.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/KernelExecutionFixture.hpp>
+
+#include <catch2/catch.hpp>
+
+//#############################################################################
+class AtomicBlockAggregatorTestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        bool * success) const
+    -> void
+    {
+        auto & sum = alpaka::block::shared::st::allocVar<unsigned int, __COUNTER__>(acc);
+        auto & max = alpaka::block::shared::st::allocVar<int, __COUNTER__>(acc);
+
+        auto const blockThreadIdx(static_cast<unsigned int>(alpaka::idx::getIdx<alpaka::Block, alpaka::Threads>(acc)[0u]));
+        auto const blockThreadCount(static_cast<unsigned int>(alpaka::workdiv::getWorkDiv<alpaka::Block, alpaka::Threads>(acc)[0u]));
+
+        if(blockThreadIdx == 0u)
+        {
+            sum = 0u;
+            max = -1;
+        }
+
+        alpaka::atomic::AtomicBlockAggregator<alpaka::atomic::op::Add, unsigned int> const addAggregator(acc);
+        alpaka::atomic::AtomicBlockAggregator<alpaka::atomic::op::Max, int> const maxAggregator(acc);
+
+        // The aggregators are reused to check that they are reset after each operation.
+        for(unsigned int i(0u); i < 2u; ++i)
+        {
+            auto const value(blockThreadIdx + 1u);
+            auto const oldSum(addAggregator(acc, &sum, value));
+            auto const oldMax(maxAggregator(acc, &max, static_cast<int>(blockThreadIdx + i * blockThreadCount)));
+
+            // The old values lie between the values before and after the operations of the block.
+            auto const sumBefore(i * blockThreadCount * (blockThreadCount + 1u) / 2u);
+            ALPAKA_CHECK(*success, oldSum >= sumBefore);
+            ALPAKA_CHECK(*success, oldSum + value <= sumBefore + blockThreadCount * (blockThreadCount + 1u) / 2u);
+            ALPAKA_CHECK(*success, oldMax >= static_cast<int>(i * blockThreadCount) - 1);
+            ALPAKA_CHECK(*success, oldMax < static_cast<int>((i + 1u) * blockThreadCount));
+        }
+        alpaka::block::sync::syncBlockThreads(acc);
+
+        ALPAKA_CHECK(*success, sum == blockThreadCount * (blockThreadCount + 1u));
+        ALPAKA_CHECK(*success, max == static_cast<int>(2u * blockThreadCount) - 1);
+    }
+};
+
+using TestAccs = alpaka::test::acc::EnabledAccs<
+    alpaka::dim::DimInt<1u>,
+    std::size_t>;
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "atomicBlockAggregatorCombinesTheOperationsOfABlock", "[atomic]", TestAccs)
+{
+    using Acc = TestType;
+    using Dim = alpaka::dim::Dim<Acc>;
+    using Idx = alpaka::idx::Idx<Acc>;
+
+    alpaka::test::KernelExecutionFixture<Acc> fixture(
+        alpaka::vec::Vec<Dim, Idx>(static_cast<Idx>(32u)));
+
+    AtomicBlockAggregatorTestKernel kernel;
+
+    REQUIRE(fixture(kernel));
+}
@@ -998,3 +998,61 @@ TEMPLATE_LIST_TEST_CASE( "atomicOperationsWorking", "[atomic]", TestAccs)
     //TestAtomicOperations<Acc, float>::testAtomicOperations();
     //TestAtomicOperations<Acc, double>::testAtomicOperations();
 }
+
+//#############################################################################
+//! All threads of a block update the same value concurrently.
+class AtomicConcurrentTestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        bool * success) const
+    -> void
+    {
+        auto & sum = alpaka::block::shared::st::allocVar<unsigned int, __COUNTER__>(acc);
+        auto & sumFloat = alpaka::block::shared::st::allocVar<float, __COUNTER__>(acc);
+        auto & max = alpaka::block::shared::st::allocVar<int, __COUNTER__>(acc);
+
+        auto const blockThreadIdx(static_cast<int>(alpaka::idx::getIdx<alpaka::Block, alpaka::Threads>(acc)[0u]));
+        auto const blockThreadCount(static_cast<int>(alpaka::workdiv::getWorkDiv<alpaka::Block, alpaka::Threads>(acc)[0u]));
+
+        if(blockThreadIdx == 0)
+        {
+            sum = 0u;
+            sumFloat = 0.0f;
+            max = 0;
+        }
+        alpaka::block::sync::syncBlockThreads(acc);
+
+        for(int i(0); i < 100; ++i)
+        {
+            alpaka::atomic::atomicOp<alpaka::atomic::op::Add>(acc, &sum, 1u);
+            alpaka::atomic::atomicOp<alpaka::atomic::op::Add>(acc, &sumFloat, 1.0f);
+            alpaka::atomic::atomicOp<alpaka::atomic::op::Max>(acc, &max, blockThreadIdx * 100 + i);
+        }
+        alpaka::block::sync::syncBlockThreads(acc);
+
+        ALPAKA_CHECK(*success, sum == static_cast<unsigned int>(blockThreadCount * 100));
+        ALPAKA_CHECK(*success, static_cast<int>(sumFloat) == blockThreadCount * 100);
+        ALPAKA_CHECK(*success, max == blockThreadCount * 100 - 1);
+    }
+};
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "atomicOperationsAreAtomic", "[atomic]", TestAccs)
+{
+    using Acc = TestType;
+    using Dim = alpaka::dim::Dim<Acc>;
+    using Idx = alpaka::idx::Idx<Acc>;
+
+    alpaka::test::KernelExecutionFixture<Acc> fixture(
+        alpaka::vec::Vec<Dim, Idx>(static_cast<Idx>(32u)));
+
+    AtomicConcurrentTestKernel kernel;
+
+    REQUIRE(fixture(kernel));
+}
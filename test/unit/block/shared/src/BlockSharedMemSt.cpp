@@ -16,6 +16,8 @@
 
 #include <catch2/catch.hpp>
 
+#include <algorithm>
+
 //#############################################################################
 class BlockSharedMemStNonNullTestKernel
 {
@@ -135,3 +137,70 @@ TEMPLATE_LIST_TEST_CASE( "sameTypeDifferentAddress", "[blockSharedMemSt]", alpak
 
     REQUIRE(fixture(kernel));
 }
+
+//#############################################################################
+class BlockSharedMemStPrivateToBlockTestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        bool * success) const
+    -> void
+    {
+        using Idx = alpaka::idx::Idx<TAcc>;
+
+        auto const gridBlockIdx1d(
+            alpaka::idx::mapIdx<1u>(
+                alpaka::idx::getIdx<alpaka::Grid, alpaka::Blocks>(acc),
+                alpaka::workdiv::getWorkDiv<alpaka::Grid, alpaka::Blocks>(acc))[0]);
+        bool const isBlockMasterThread(
+            alpaka::idx::getIdx<alpaka::Block, alpaka::Threads>(acc).sum() == static_cast<Idx>(0u));
+
+        // Multiple runs to make sure it really works.
+        for(std::size_t i=0u; i<10; ++i)
+        {
+            auto & blockIdx = alpaka::block::shared::st::allocVar<Idx, __COUNTER__>(acc);
+
+            if(isBlockMasterThread)
+            {
+                blockIdx = gridBlockIdx1d;
+            }
+            alpaka::block::sync::syncBlockThreads(acc);
+
+            // Blocks which are executed at the same time must not see the shared memory of each other.
+            ALPAKA_CHECK(*success, blockIdx == gridBlockIdx1d);
+            alpaka::block::sync::syncBlockThreads(acc);
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "privateToBlock", "[blockSharedMemSt]", alpaka::test::acc::TestAccs)
+{
+    using Acc = TestType;
+    using Dim = alpaka::dim::Dim<Acc>;
+    using Idx = alpaka::idx::Idx<Acc>;
+
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::Pltf<alpaka::dev::Dev<Acc>>>(0u));
+    auto const devProps(alpaka::acc::getAccDevProps<Acc>(dev));
+
+    // Use many small blocks to make sure that multiple blocks are executed concurrently where supported.
+    auto blockThreadExtent(alpaka::vec::Vec<Dim, Idx>::ones());
+    blockThreadExtent[0] = std::min(
+        static_cast<Idx>(2u),
+        std::min(devProps.m_blockThreadExtentMax[0], devProps.m_blockThreadCountMax));
+
+    alpaka::test::KernelExecutionFixture<Acc> fixture(
+        alpaka::workdiv::WorkDivMembers<Dim, Idx>(
+            alpaka::vec::Vec<Dim, Idx>::all(static_cast<Idx>(4u)),
+            blockThreadExtent,
+            alpaka::vec::Vec<Dim, Idx>::ones()));
+
+    BlockSharedMemStPrivateToBlockTestKernel kernel;
+
+    REQUIRE(fixture(kernel));
+}
@@ -0,0 +1,62 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/core/BarrierThread.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+TEST_CASE("barrierThreadTreeReleasesTheThreadsOnlyAfterAllHaveArrived", "[core]")
+{
+    std::size_t const fanIn(ALPAKA_THREAD_BARRIER_TREE_FAN_IN);
+    std::size_t const generationCount(32u);
+
+    // A single leaf, a full leaf, a second leaf and a second tree level.
+    for(std::size_t const threadCount : {std::size_t(1u), fanIn, fanIn + 1u, fanIn * fanIn + 1u})
+    {
+        alpaka::core::threads::BarrierThreadTree<std::size_t> barrier(threadCount);
+
+        std::vector<std::atomic<std::size_t>> arrivedThreadCounts(generationCount);
+        for(auto & arrivedThreadCount : arrivedThreadCounts)
+        {
+            arrivedThreadCount = 0u;
+        }
+        std::atomic<bool> releasedEarly(false);
+
+        std::vector<std::thread> threads;
+        for(std::size_t threadIdx(0u); threadIdx < threadCount; ++threadIdx)
+        {
+            threads.emplace_back(
+                [&barrier, &arrivedThreadCounts, &releasedEarly, threadCount]()
+                {
+                    for(auto & arrivedThreadCount : arrivedThreadCounts)
+                    {
+                        ++arrivedThreadCount;
+                        barrier.wait();
+                        if(arrivedThreadCount != threadCount)
+                        {
+                            releasedEarly = true;
+                        }
+                    }
+                });
+        }
+        for(auto & thread : threads)
+        {
+            thread.join();
+        }
+
+        INFO("threadCount: " << threadCount);
+        CHECK(!releasedEarly);
+    }
+}
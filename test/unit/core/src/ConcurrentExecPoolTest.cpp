@@ -0,0 +1,159 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/core/ConcurrentExecPool.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+//#############################################################################
+struct ThreadPoolYield
+{
+    //-----------------------------------------------------------------------------
+    static auto yield()
+    -> void
+    {
+        std::this_thread::yield();
+    }
+};
+
+//#############################################################################
+template<
+    bool TisYielding,
+    template<typename TTask> class TTaskQueue>
+using ThreadPool =
+    alpaka::core::detail::ConcurrentExecPool<
+        std::size_t,
+        std::thread,
+        std::promise,
+        ThreadPoolYield,
+        std::mutex,
+        std::condition_variable,
+        TisYielding,
+        TTaskQueue>;
+
+using ThreadPools =
+    std::tuple<
+        ThreadPool<true, alpaka::core::detail::ThreadSafeQueue>,
+        ThreadPool<false, alpaka::core::detail::ThreadSafeQueue>,
+        ThreadPool<true, alpaka::core::detail::WorkStealingQueue>,
+        ThreadPool<false, alpaka::core::detail::WorkStealingQueue>>;
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE("allTasksAreExecuted", "[core]", ThreadPools)
+{
+    TestType pool(4u);
+
+    std::size_t const numTasks(10000u);
+    std::vector<std::future<std::size_t>> futures;
+    futures.reserve(numTasks);
+    for(std::size_t i(0u); i < numTasks; ++i)
+    {
+        futures.emplace_back(pool.enqueueTask([i](){ return 2u * i; }));
+    }
+
+    for(std::size_t i(0u); i < numTasks; ++i)
+    {
+        REQUIRE(futures[i].get() == 2u * i);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE("tasksWaitingForEachOtherMakeProgress", "[core]", ThreadPools)
+{
+    // Like the threads of a block, all tasks have to run at the same time to get past the barrier.
+    std::size_t const numTasks(8u);
+    TestType pool(2u);
+    pool.reserveConcurrentExecutionCount(numTasks);
+    REQUIRE(pool.getConcurrentExecutionCount() == numTasks);
+
+    for(std::size_t run(0u); run < 10u; ++run)
+    {
+        std::atomic<std::size_t> arrived(0u);
+        std::vector<std::future<void>> futures;
+        for(std::size_t i(0u); i < numTasks; ++i)
+        {
+            futures.emplace_back(
+                pool.enqueueTask(
+                    [&arrived, numTasks]()
+                    {
+                        ++arrived;
+                        while(arrived.load() < numTasks)
+                        {
+                            std::this_thread::yield();
+                        }
+                    }));
+        }
+
+        for(auto & future : futures)
+        {
+            future.wait();
+        }
+        REQUIRE(arrived.load() == numTasks);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE("intrusiveTasksSignalLatch", "[core]", ThreadPools)
+{
+    using Latch = alpaka::core::detail::CompletionLatch<std::mutex, std::condition_variable>;
+
+    TestType pool(4u);
+
+    std::size_t const numTasks(1000u);
+    std::vector<std::size_t> results(numTasks, 0u);
+
+    auto makeTask(
+        [&results](std::size_t i)
+        {
+            return [&results, i](){ results[i] = 2u * i; };
+        });
+    using Task = alpaka::core::detail::IntrusiveTaskPkg<Latch, decltype(makeTask(0u))>;
+
+    Latch latch(numTasks);
+    std::vector<Task> tasks;
+    tasks.reserve(numTasks);
+    for(std::size_t i(0u); i < numTasks; ++i)
+    {
+        tasks.emplace_back(latch, makeTask(i));
+        pool.enqueueIntrusiveTask(tasks.back());
+    }
+    latch.wait();
+
+    REQUIRE(pool.isIdle());
+    for(std::size_t i(0u); i < numTasks; ++i)
+    {
+        REQUIRE(results[i] == 2u * i);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE("intrusiveTaskExceptionIsRethrownByLatch", "[core]", ThreadPools)
+{
+    using Latch = alpaka::core::detail::CompletionLatch<std::mutex, std::condition_variable>;
+
+    TestType pool(2u);
+
+    Latch latch(1u);
+    auto throwingFn([](){ throw std::runtime_error("task failed"); });
+    alpaka::core::detail::IntrusiveTaskPkg<Latch, decltype(throwingFn)> task(
+        latch,
+        std::move(throwingFn));
+    pool.enqueueIntrusiveTask(task);
+
+    REQUIRE_THROWS_AS(latch.wait(), std::runtime_error);
+}
@@ -0,0 +1,231 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/core/StrandExecutor.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+TEST_CASE("strandsExecuteTheirTasksInOrder", "[core]")
+{
+    alpaka::core::detail::StrandExecutor executor;
+
+    std::size_t const strandCount(64u);
+    std::size_t const numTasksPerStrand(100u);
+
+    std::vector<std::unique_ptr<alpaka::core::detail::Strand>> strands;
+    std::vector<std::vector<std::size_t>> executedTasks(strandCount);
+    std::vector<std::future<void>> futures;
+    for(std::size_t strandIdx(0u); strandIdx < strandCount; ++strandIdx)
+    {
+        strands.emplace_back(std::make_unique<alpaka::core::detail::Strand>(executor));
+    }
+    for(std::size_t taskIdx(0u); taskIdx < numTasksPerStrand; ++taskIdx)
+    {
+        for(std::size_t strandIdx(0u); strandIdx < strandCount; ++strandIdx)
+        {
+            // Each strand executes its tasks one after the other, so they do not have to be synchronized.
+            auto & executed(executedTasks[strandIdx]);
+            futures.emplace_back(strands[strandIdx]->enqueueTask([&executed, taskIdx](){executed.push_back(taskIdx);}));
+        }
+    }
+    for(auto & future : futures)
+    {
+        future.get();
+    }
+
+    for(std::size_t strandIdx(0u); strandIdx < strandCount; ++strandIdx)
+    {
+        REQUIRE(strands[strandIdx]->isIdle());
+        REQUIRE(executedTasks[strandIdx].size() == numTasksPerStrand);
+        for(std::size_t taskIdx(0u); taskIdx < numTasksPerStrand; ++taskIdx)
+        {
+            REQUIRE(executedTasks[strandIdx][taskIdx] == taskIdx);
+        }
+    }
+
+    // The strands do not own threads.
+    REQUIRE(executor.getWorkerCount() <= std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), static_cast<std::size_t>(1u)));
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("strandWaitingForAnotherStrandDoesNotDeadlock", "[core]")
+{
+    alpaka::core::detail::StrandExecutor executor;
+
+    // Occupy all workers with waiting strands before the signaling task is enqueued.
+    // The waits are marked as blocking, so a further worker is started for the signaling strand.
+    std::promise<void> promise;
+    auto sharedFuture(promise.get_future().share());
+    std::vector<std::unique_ptr<alpaka::core::detail::Strand>> waitingStrands;
+    std::vector<std::future<void>> waitingFutures;
+    for(unsigned i(0u); i < std::max(std::thread::hardware_concurrency(), 1u); ++i)
+    {
+        waitingStrands.emplace_back(std::make_unique<alpaka::core::detail::Strand>(executor));
+        waitingFutures.emplace_back(waitingStrands.back()->enqueueTask(
+                [sharedFuture]()
+                {
+                    alpaka::core::detail::StrandExecutor::BlockingScope const blocking;
+                    sharedFuture.wait();
+                }));
+    }
+    alpaka::core::detail::Strand signaling(executor);
+    auto signalingFuture(signaling.enqueueTask([&promise](){promise.set_value();}));
+
+    signalingFuture.get();
+    for(auto & future : waitingFutures)
+    {
+        future.get();
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("blockedWorkerIsReplaced", "[core]")
+{
+    // A single worker, so only the blocking call can start another worker.
+    alpaka::core::detail::StrandExecutor executor(1u);
+
+    alpaka::core::detail::Strand waiting(executor);
+    alpaka::core::detail::Strand signaling(executor);
+    auto waitingFuture(
+        waiting.enqueueTask(
+            [&executor, &signaling]()
+            {
+                bool const bBlocking(executor.beginBlocking());
+                auto signalingFuture(signaling.enqueueTask([](){}));
+                auto const status(signalingFuture.wait_for(std::chrono::seconds(10)));
+                if(bBlocking)
+                {
+                    executor.endBlocking();
+                }
+                return bBlocking && (status == std::future_status::ready);
+            }));
+
+    CHECK(waitingFuture.get());
+    // The caller of beginBlocking is not a worker of the executor.
+    CHECK(!executor.beginBlocking());
+}
+
+//-----------------------------------------------------------------------------
+namespace
+{
+    //! Occupies the single worker of the executor, enqueues a task into a strand of each priority in the given order and releases the worker.
+    //! \return The priorities in the order their tasks have been started.
+    auto startTasksOnASingleBusyWorker(
+        std::chrono::milliseconds const agingTime,
+        std::vector<alpaka::queue::Priority> const & enqueuedPriorities)
+    -> std::vector<alpaka::queue::Priority>
+    {
+        // The busy worker is not marked as blocked, so no further worker is started while the test runs.
+        alpaka::core::detail::StrandExecutor executor(1u, agingTime);
+
+        std::promise<void> started;
+        std::promise<void> release;
+        auto releaseFuture(release.get_future().share());
+        alpaka::core::detail::Strand blocking(executor);
+        auto blockingFuture(
+            blocking.enqueueTask(
+                [&started, releaseFuture]()
+                {
+                    started.set_value();
+                    releaseFuture.wait();
+                }));
+        started.get_future().wait();
+
+        std::mutex startedMutex;
+        std::vector<alpaka::queue::Priority> startedPriorities;
+        std::vector<std::unique_ptr<alpaka::core::detail::Strand>> strands;
+        std::vector<std::future<void>> futures;
+        for(auto const priority : enqueuedPriorities)
+        {
+            strands.emplace_back(std::make_unique<alpaka::core::detail::Strand>(executor, priority));
+            futures.emplace_back(
+                strands.back()->enqueueTask(
+                    [&startedMutex, &startedPriorities, priority]()
+                    {
+                        std::lock_guard<std::mutex> lock(startedMutex);
+                        startedPriorities.push_back(priority);
+                    }));
+        }
+
+        release.set_value();
+        blockingFuture.get();
+        for(auto & future : futures)
+        {
+            future.get();
+        }
+        return startedPriorities;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("readyStrandsAreStartedInTheOrderOfTheirPriority", "[core]")
+{
+    auto const startedPriorities(
+        startTasksOnASingleBusyWorker(
+            std::chrono::hours(1),
+            {alpaka::queue::Priority::Low, alpaka::queue::Priority::Normal, alpaka::queue::Priority::High}));
+
+    CHECK(startedPriorities == std::vector<alpaka::queue::Priority>{alpaka::queue::Priority::High, alpaka::queue::Priority::Normal, alpaka::queue::Priority::Low});
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("agedReadyStrandsAreStartedInFifoOrder", "[core]")
+{
+    // Every strand has aged by the time the worker is released.
+    auto const startedPriorities(
+        startTasksOnASingleBusyWorker(
+            std::chrono::milliseconds(0),
+            {alpaka::queue::Priority::Low, alpaka::queue::Priority::Normal, alpaka::queue::Priority::High}));
+
+    CHECK(startedPriorities == std::vector<alpaka::queue::Priority>{alpaka::queue::Priority::Low, alpaka::queue::Priority::Normal, alpaka::queue::Priority::High});
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("workerCountIsBoundedUnderCpuBoundLoad", "[core]")
+{
+    std::size_t const workerCountMax(2u);
+    alpaka::core::detail::StrandExecutor executor(workerCountMax);
+
+    std::size_t const strandCount(200u);
+    std::mutex workerCountMutex;
+    std::size_t maxWorkerCount(0u);
+    std::vector<std::unique_ptr<alpaka::core::detail::Strand>> strands;
+    std::vector<std::future<void>> futures;
+    for(std::size_t strandIdx(0u); strandIdx < strandCount; ++strandIdx)
+    {
+        strands.emplace_back(std::make_unique<alpaka::core::detail::Strand>(executor));
+        futures.emplace_back(
+            strands.back()->enqueueTask(
+                [&executor, &workerCountMutex, &maxWorkerCount]()
+                {
+                    // Busy tasks never block, so they do not justify further workers.
+                    auto const end(std::chrono::steady_clock::now() + std::chrono::milliseconds(1));
+                    while(std::chrono::steady_clock::now() < end)
+                    {
+                    }
+                    std::lock_guard<std::mutex> lock(workerCountMutex);
+                    maxWorkerCount = std::max(maxWorkerCount, executor.getWorkerCount());
+                }));
+    }
+    for(auto & future : futures)
+    {
+        future.get();
+    }
+
+    CHECK(maxWorkerCount <= workerCountMax);
+}
@@ -0,0 +1,199 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of Alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/dev/DevCpu.hpp>
+#include <alpaka/pltf/PltfCpu.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//#############################################################################
+//! Sets the block thread limit of the device and restores the previous one when destroyed.
+class ScopedBlockThreadCountMax
+{
+public:
+    //-----------------------------------------------------------------------------
+    ScopedBlockThreadCountMax(
+        alpaka::dev::DevCpu const & dev,
+        std::size_t const blockThreadCountMax) :
+            m_dev(dev),
+            m_prevBlockThreadCountMax(dev.getBlockThreadCountMax())
+    {
+        m_dev.setBlockThreadCountMax(blockThreadCountMax);
+    }
+    //-----------------------------------------------------------------------------
+    ScopedBlockThreadCountMax(ScopedBlockThreadCountMax const &) = delete;
+    //-----------------------------------------------------------------------------
+    auto operator=(ScopedBlockThreadCountMax const &) -> ScopedBlockThreadCountMax & = delete;
+    //-----------------------------------------------------------------------------
+    ~ScopedBlockThreadCountMax()
+    {
+        m_dev.setBlockThreadCountMax(m_prevBlockThreadCountMax);
+    }
+
+private:
+    alpaka::dev::DevCpu const m_dev;
+    std::size_t const m_prevBlockThreadCountMax;
+};
+
+//-----------------------------------------------------------------------------
+TEST_CASE("devCpuHandlesShareTheDeviceState", "[dev]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    auto const devOther(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+
+    CHECK(dev == devOther);
+    CHECK(dev.m_spDevCpuImpl == devOther.m_spDevCpuImpl);
+
+    // The block threads are pre-warmed once per device, not once per handle.
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED) && ALPAKA_CPU_DEV_PREWARM_BLOCK_THREADS
+    CHECK(dev.m_spDevCpuImpl->getIdleBlockThreadPoolCount() == 1u);
+#else
+    CHECK(dev.m_spDevCpuImpl->getIdleBlockThreadPoolCount() == 0u);
+#endif
+}
+
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED) && ALPAKA_CPU_DEV_PREWARM_BLOCK_THREADS
+//-----------------------------------------------------------------------------
+TEST_CASE("firstKernelLaunchUsesThePreWarmedBlockThreads", "[dev]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    ScopedBlockThreadCountMax const unlimited(dev, 0u);
+    REQUIRE(dev.m_spDevCpuImpl->getIdleBlockThreadPoolCount() == 1u);
+
+    auto const threadCount(std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), static_cast<std::size_t>(1u)));
+    auto upPool(dev.m_spDevCpuImpl->acquireBlockThreadPool(threadCount));
+    CHECK(upPool->getConcurrentExecutionCount() >= threadCount);
+    CHECK(dev.m_spDevCpuImpl->getIdleBlockThreadPoolCount() == 0u);
+
+    dev.m_spDevCpuImpl->releaseBlockThreadPool(std::move(upPool), threadCount);
+}
+#endif
+
+//-----------------------------------------------------------------------------
+TEST_CASE("devCpuHandlesShareTheStrandExecutor", "[dev]")
+{
+    // Queues created on different handles of the same device are scheduled by one executor.
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    auto const devOther(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+
+    CHECK(&dev.getStrandExecutor() == &devOther.getStrandExecutor());
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("idleBlockThreadPoolsAreCapped", "[dev]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    // All pools are leased by this thread at the same time.
+    ScopedBlockThreadCountMax const unlimited(dev, 0u);
+
+    std::size_t const poolCount(static_cast<std::size_t>(ALPAKA_CPU_DEV_IDLE_BLOCK_THREAD_POOL_COUNT_MAX) + 2u);
+    std::vector<std::unique_ptr<alpaka::dev::cpu::detail::BlockThreadPool>> upPools;
+    for(std::size_t poolIdx(0u); poolIdx < poolCount; ++poolIdx)
+    {
+        upPools.emplace_back(dev.m_spDevCpuImpl->acquireBlockThreadPool(1u));
+    }
+    for(auto & upPool : upPools)
+    {
+        dev.m_spDevCpuImpl->releaseBlockThreadPool(std::move(upPool), 1u);
+    }
+
+    CHECK(dev.m_spDevCpuImpl->getIdleBlockThreadPoolCount() == static_cast<std::size_t>(ALPAKA_CPU_DEV_IDLE_BLOCK_THREAD_POOL_COUNT_MAX));
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("blockThreadPoolIsReusedAndGrown", "[dev]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    // Two pools are leased by this thread at the same time.
+    ScopedBlockThreadCountMax const unlimited(dev, 0u);
+
+    auto upPool(dev.m_spDevCpuImpl->acquireBlockThreadPool(3u));
+    REQUIRE(upPool->getConcurrentExecutionCount() >= 3u);
+    auto const * const pPool(upPool.get());
+    dev.m_spDevCpuImpl->releaseBlockThreadPool(std::move(upPool), 3u);
+
+    // The released pool is handed out again and grown to the requested size.
+    auto const grownThreadCount(2u * pPool->getConcurrentExecutionCount());
+    auto upPoolGrown(dev.m_spDevCpuImpl->acquireBlockThreadPool(grownThreadCount));
+    REQUIRE(upPoolGrown.get() == pPool);
+
+    // A pool which is in use is never handed out a second time.
+    auto upPoolOther(dev.m_spDevCpuImpl->acquireBlockThreadPool(1u));
+    REQUIRE(upPoolOther.get() != pPool);
+
+    dev.m_spDevCpuImpl->releaseBlockThreadPool(std::move(upPoolOther), 1u);
+    dev.m_spDevCpuImpl->releaseBlockThreadPool(std::move(upPoolGrown), grownThreadCount);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("blockThreadClaimLatencyIsRecordedPerPriority", "[dev]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+
+    // The device state is shared with the other handles, so only the claims of this test are counted.
+    auto const highClaimCount(dev.getBlockThreadClaimLatency(alpaka::queue::Priority::High).m_count);
+    auto const normalClaimCount(dev.getBlockThreadClaimLatency(alpaka::queue::Priority::Normal).m_count);
+
+    auto upPool(dev.m_spDevCpuImpl->acquireBlockThreadPool(1u, alpaka::queue::Priority::High));
+    dev.m_spDevCpuImpl->releaseBlockThreadPool(std::move(upPool), 1u);
+
+    CHECK(dev.getBlockThreadClaimLatency(alpaka::queue::Priority::High).m_count == highClaimCount + 1u);
+    CHECK(dev.getBlockThreadClaimLatency(alpaka::queue::Priority::Normal).m_count == normalClaimCount);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("blockThreadClaimsAreGrantedInPriorityOrder", "[dev]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    auto const otherDev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+
+    // Each claim needs all block threads, so the claims are granted one after the other.
+    std::size_t const blockThreadCount(2u);
+    ScopedBlockThreadCountMax const limit(dev, blockThreadCount);
+    REQUIRE(otherDev.getBlockThreadCountMax() == blockThreadCount);
+    auto upHeldPool(dev.m_spDevCpuImpl->acquireBlockThreadPool(blockThreadCount));
+
+    std::mutex grantedMutex;
+    std::vector<alpaka::queue::Priority> grantedPriorities;
+    auto const claim(
+        [&dev, &grantedMutex, &grantedPriorities, blockThreadCount](alpaka::queue::Priority const priority)
+        {
+            auto upPool(dev.m_spDevCpuImpl->acquireBlockThreadPool(blockThreadCount, priority));
+            {
+                std::lock_guard<std::mutex> lock(grantedMutex);
+                grantedPriorities.push_back(priority);
+            }
+            dev.m_spDevCpuImpl->releaseBlockThreadPool(std::move(upPool), blockThreadCount);
+        });
+
+    // The low priority claim is waiting before the high priority one arrives.
+    std::thread low(claim, alpaka::queue::Priority::Low);
+    while(dev.m_spDevCpuImpl->getWaitingBlockThreadClaimCount(alpaka::queue::Priority::Low) != 1u)
+    {
+        std::this_thread::yield();
+    }
+    std::thread high(claim, alpaka::queue::Priority::High);
+    while(dev.m_spDevCpuImpl->getWaitingBlockThreadClaimCount(alpaka::queue::Priority::High) != 1u)
+    {
+        std::this_thread::yield();
+    }
+
+    dev.m_spDevCpuImpl->releaseBlockThreadPool(std::move(upHeldPool), blockThreadCount);
+    low.join();
+    high.join();
+
+    CHECK(grantedPriorities == std::vector<alpaka::queue::Priority>{alpaka::queue::Priority::High, alpaka::queue::Priority::Low});
+}
@@ -0,0 +1,122 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/core/StrandExecutor.hpp>
+#include <alpaka/event/EventCpu.hpp>
+#include <alpaka/pltf/PltfCpu.hpp>
+#include <alpaka/queue/QueueCpuNonBlocking.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+TEST_CASE("cpuEventStaysReadyWhenAnEarlierEnqueueCompletesLast", "[event]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    alpaka::queue::QueueCpuNonBlocking q1(dev);
+    alpaka::queue::QueueCpuNonBlocking q2(dev);
+    alpaka::event::EventCpu e1(dev);
+
+    std::promise<void> release1;
+    auto release1Future(release1.get_future().share());
+    alpaka::queue::enqueue(
+        q1,
+        [release1Future]()
+        {
+            // The wait is marked as blocking, so the executor starts another worker for q2.
+            alpaka::core::detail::StrandExecutor::BlockingScope const blocking;
+            release1Future.wait();
+        });
+    alpaka::queue::enqueue(q1, e1);
+    CHECK(!alpaka::event::test(e1));
+
+    // The re-enqueue into the idle q2 completes while the first enqueue into q1 is still pending.
+    alpaka::queue::enqueue(q2, e1);
+    alpaka::wait::wait(q2);
+    CHECK(alpaka::event::test(e1));
+
+    // The completion of the outdated enqueue must not reset the event.
+    release1.set_value();
+    alpaka::wait::wait(q1);
+    CHECK(alpaka::event::test(e1));
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("cpuEventReleasesAllWaitingThreads", "[event]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    alpaka::queue::QueueCpuNonBlocking queue(dev);
+    alpaka::event::EventCpu event(dev);
+
+    std::atomic<bool> signaled(false);
+    alpaka::queue::enqueue(
+        queue,
+        [&signaled]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20u));
+            signaled = true;
+        });
+    alpaka::queue::enqueue(queue, event);
+
+    std::size_t const numWaiters(8u);
+    std::atomic<std::size_t> numWaitersSawSignal(0u);
+    std::vector<std::thread> waiters;
+    for(std::size_t waiterIdx(0u); waiterIdx < numWaiters; ++waiterIdx)
+    {
+        waiters.emplace_back(
+            [&event, &signaled, &numWaitersSawSignal]()
+            {
+                alpaka::wait::wait(event);
+                if(signaled)
+                {
+                    ++numWaitersSawSignal;
+                }
+            });
+    }
+    for(auto & waiter : waiters)
+    {
+        waiter.join();
+    }
+
+    CHECK(numWaitersSawSignal == numWaiters);
+    CHECK(alpaka::event::test(event));
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("cpuEventCallsTheContinuationsWhenCompleted", "[event]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    alpaka::queue::QueueCpuNonBlocking queue(dev);
+    alpaka::event::EventCpu event(dev);
+
+    // A ready event does not register the continuation.
+    std::atomic<std::size_t> continuationCount(0u);
+    CHECK(!event.m_spEventImpl->addContinuation(event.m_spEventImpl->m_enqueueCount.load(), [&continuationCount](){++continuationCount;}));
+
+    std::promise<void> release;
+    auto releaseFuture(release.get_future().share());
+    alpaka::queue::enqueue(queue, [releaseFuture](){releaseFuture.wait();});
+    alpaka::queue::enqueue(queue, event);
+
+    auto const enqueueCount(event.m_spEventImpl->m_enqueueCount.load());
+    CHECK(event.m_spEventImpl->addContinuation(enqueueCount, [&continuationCount](){++continuationCount;}));
+    CHECK(event.m_spEventImpl->addContinuation(enqueueCount, [&continuationCount](){++continuationCount;}));
+    CHECK(continuationCount == 0u);
+
+    // The continuations are called by the queue before it executes the tasks enqueued later.
+    release.set_value();
+    alpaka::wait::wait(queue);
+    CHECK(continuationCount == 2u);
+}
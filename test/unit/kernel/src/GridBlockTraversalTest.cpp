@@ -0,0 +1,113 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/kernel/GridBlockTraversal.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    using Dim = alpaka::dim::DimInt<2u>;
+    using Idx = std::uint32_t;
+    using Vec = alpaka::vec::Vec<Dim, Idx>;
+
+    //-----------------------------------------------------------------------------
+    //! \return The grid block indices of a 4x4 grid in the traversal order of the given schedule.
+    auto getGridBlockIdxs(
+        alpaka::kernel::BlockSchedule const & blockSchedule)
+    -> std::vector<Vec>
+    {
+        Vec const gridBlockExtent(4u, 4u);
+        alpaka::kernel::detail::GridBlockTraversal<Dim, Idx> const gridBlockTraversal(
+            blockSchedule,
+            gridBlockExtent);
+
+        std::vector<Vec> gridBlockIdxs;
+        for(Idx i(0u); i < gridBlockExtent.prod(); ++i)
+        {
+            gridBlockIdxs.push_back(gridBlockTraversal.getGridBlockIdx(i));
+        }
+        return gridBlockIdxs;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("gridBlockTraversalRowMajor", "[kernel]")
+{
+    using Order = alpaka::kernel::BlockTraversalOrder;
+    std::vector<Vec> const expected{
+        Vec(0u, 0u), Vec(0u, 1u), Vec(0u, 2u), Vec(0u, 3u),
+        Vec(1u, 0u), Vec(1u, 1u), Vec(1u, 2u), Vec(1u, 3u),
+        Vec(2u, 0u), Vec(2u, 1u), Vec(2u, 2u), Vec(2u, 3u),
+        Vec(3u, 0u), Vec(3u, 1u), Vec(3u, 2u), Vec(3u, 3u)};
+
+    CHECK(getGridBlockIdxs(alpaka::kernel::BlockSchedule(alpaka::kernel::BlockSchedulingPolicy::Auto, 0u, Order::RowMajor)) == expected);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("gridBlockTraversalTiled", "[kernel]")
+{
+    using Order = alpaka::kernel::BlockTraversalOrder;
+    // The tiles at the right and the bottom border are clipped.
+    std::vector<Vec> const expected{
+        Vec(0u, 0u), Vec(0u, 1u), Vec(0u, 2u),
+        Vec(1u, 0u), Vec(1u, 1u), Vec(1u, 2u),
+        Vec(2u, 0u), Vec(2u, 1u), Vec(2u, 2u),
+        Vec(0u, 3u), Vec(1u, 3u), Vec(2u, 3u),
+        Vec(3u, 0u), Vec(3u, 1u), Vec(3u, 2u),
+        Vec(3u, 3u)};
+
+    CHECK(getGridBlockIdxs(alpaka::kernel::BlockSchedule(alpaka::kernel::BlockSchedulingPolicy::Auto, 0u, Order::Tiled, 3u)) == expected);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("gridBlockTraversalZOrder", "[kernel]")
+{
+    using Order = alpaka::kernel::BlockTraversalOrder;
+    std::vector<Vec> const expected{
+        Vec(0u, 0u), Vec(0u, 1u), Vec(1u, 0u), Vec(1u, 1u),
+        Vec(0u, 2u), Vec(0u, 3u), Vec(1u, 2u), Vec(1u, 3u),
+        Vec(2u, 0u), Vec(2u, 1u), Vec(3u, 0u), Vec(3u, 1u),
+        Vec(2u, 2u), Vec(2u, 3u), Vec(3u, 2u), Vec(3u, 3u)};
+
+    CHECK(getGridBlockIdxs(alpaka::kernel::BlockSchedule(alpaka::kernel::BlockSchedulingPolicy::Auto, 0u, Order::ZOrder)) == expected);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("gridBlockTraversalHilbert", "[kernel]")
+{
+    using Order = alpaka::kernel::BlockTraversalOrder;
+    // The second order Hilbert curve starting in the origin.
+    std::vector<Vec> const expected{
+        Vec(0u, 0u), Vec(1u, 0u), Vec(1u, 1u), Vec(0u, 1u),
+        Vec(0u, 2u), Vec(0u, 3u), Vec(1u, 3u), Vec(1u, 2u),
+        Vec(2u, 2u), Vec(2u, 3u), Vec(3u, 3u), Vec(3u, 2u),
+        Vec(3u, 1u), Vec(2u, 1u), Vec(2u, 0u), Vec(3u, 0u)};
+
+    CHECK(getGridBlockIdxs(alpaka::kernel::BlockSchedule(alpaka::kernel::BlockSchedulingPolicy::Auto, 0u, Order::Hilbert)) == expected);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("gridBlockTraversalIsReusedForTheSameExtent", "[kernel]")
+{
+    using Order = alpaka::kernel::BlockTraversalOrder;
+    alpaka::kernel::BlockSchedule const blockSchedule(alpaka::kernel::BlockSchedulingPolicy::Auto, 0u, Order::Hilbert);
+
+    // The second traversal is served from the cache and yields the same order.
+    CHECK(getGridBlockIdxs(blockSchedule) == getGridBlockIdxs(blockSchedule));
+    // A different extent is not served from the cache of the 4x4 grid. The first order curve has a different orientation.
+    alpaka::kernel::detail::GridBlockTraversal<Dim, Idx> const gridBlockTraversal(
+        blockSchedule,
+        Vec(2u, 2u));
+    CHECK(gridBlockTraversal.getGridBlockIdx(1u) == Vec(0u, 1u));
+    CHECK(gridBlockTraversal.getGridBlockIdx(3u) == Vec(1u, 0u));
+}
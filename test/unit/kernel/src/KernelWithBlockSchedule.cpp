@@ -0,0 +1,196 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/kernel/Traits.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/queue/Queue.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+
+//#############################################################################
+//! Counts how often each grid block is executed.
+class KernelWithBlockSchedule
+{
+public:
+    //-----------------------------------------------------------------------------
+    explicit KernelWithBlockSchedule(
+        alpaka::kernel::BlockSchedule const & blockSchedule) :
+            m_blockSchedule(blockSchedule)
+    {}
+
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        std::uint32_t * const blockExecutionCounts) const
+    -> void
+    {
+        auto const gridBlockIdx1d(
+            alpaka::idx::mapIdx<1u>(
+                alpaka::idx::getIdx<alpaka::Grid, alpaka::Blocks>(acc),
+                alpaka::workdiv::getWorkDiv<alpaka::Grid, alpaka::Blocks>(acc))[0]);
+
+        alpaka::atomic::atomicOp<alpaka::atomic::op::Add>(
+            acc,
+            &blockExecutionCounts[gridBlockIdx1d],
+            1u);
+    }
+
+    alpaka::kernel::BlockSchedule m_blockSchedule;
+};
+
+namespace alpaka
+{
+    namespace kernel
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The block schedule is chosen at runtime by the kernel object.
+            template<
+                typename TAcc>
+            struct GetBlockSchedule<
+                KernelWithBlockSchedule,
+                TAcc>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TVec>
+                ALPAKA_FN_HOST static auto getBlockSchedule(
+                    KernelWithBlockSchedule const & kernel,
+                    TVec const & blockThreadExtent,
+                    TVec const & threadElemExtent,
+                    std::uint32_t * const blockExecutionCounts)
+                -> BlockSchedule
+                {
+                    alpaka::ignore_unused(blockThreadExtent);
+                    alpaka::ignore_unused(threadElemExtent);
+                    alpaka::ignore_unused(blockExecutionCounts);
+
+                    return kernel.m_blockSchedule;
+                }
+            };
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE("everyBlockIsExecutedOnceForEachSchedule", "[kernel]", alpaka::test::acc::TestAccs)
+{
+    using Acc = TestType;
+    using Dim = alpaka::dim::Dim<Acc>;
+    using Idx = alpaka::idx::Idx<Acc>;
+    using DevAcc = alpaka::dev::Dev<Acc>;
+    using PltfAcc = alpaka::pltf::Pltf<DevAcc>;
+
+    auto const devHost(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    auto const devAcc(alpaka::pltf::getDevByIdx<PltfAcc>(0u));
+    alpaka::test::queue::DefaultQueue<DevAcc> queue(devAcc);
+
+    // A prime number of blocks so that the chunks do not divide the grid evenly.
+    Idx const gridBlockCount(97u);
+    auto gridBlockExtent(alpaka::vec::Vec<Dim, Idx>::ones());
+    gridBlockExtent[0] = gridBlockCount;
+    alpaka::workdiv::WorkDivMembers<Dim, Idx> const workDiv(
+        gridBlockExtent,
+        alpaka::vec::Vec<Dim, Idx>::ones(),
+        alpaka::vec::Vec<Dim, Idx>::ones());
+
+    using Policy = alpaka::kernel::BlockSchedulingPolicy;
+    for(auto const & blockSchedule : {
+        alpaka::kernel::BlockSchedule(),
+        alpaka::kernel::BlockSchedule(Policy::Static),
+        alpaka::kernel::BlockSchedule(Policy::Static, 5u),
+        alpaka::kernel::BlockSchedule(Policy::Dynamic),
+        alpaka::kernel::BlockSchedule(Policy::Dynamic, 4u),
+        alpaka::kernel::BlockSchedule(Policy::Guided),
+        alpaka::kernel::BlockSchedule(Policy::Guided, 3u)})
+    {
+        auto bufAcc(alpaka::mem::buf::alloc<std::uint32_t, Idx>(devAcc, gridBlockCount));
+        alpaka::mem::view::set(queue, bufAcc, static_cast<std::uint8_t>(0u), gridBlockCount);
+
+        alpaka::kernel::exec<Acc>(
+            queue,
+            workDiv,
+            KernelWithBlockSchedule(blockSchedule),
+            alpaka::mem::view::getPtrNative(bufAcc));
+
+        auto bufHost(alpaka::mem::buf::alloc<std::uint32_t, Idx>(devHost, gridBlockCount));
+        alpaka::mem::view::copy(queue, bufHost, bufAcc, gridBlockCount);
+        alpaka::wait::wait(queue);
+
+        auto const pBlockExecutionCounts(alpaka::mem::view::getPtrNative(bufHost));
+        for(Idx i(0u); i < gridBlockCount; ++i)
+        {
+            REQUIRE(pBlockExecutionCounts[i] == 1u);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE("everyBlockIsExecutedOnceForEachTraversalOrder", "[kernel]", alpaka::test::acc::TestAccs)
+{
+    using Acc = TestType;
+    using Dim = alpaka::dim::Dim<Acc>;
+    using Idx = alpaka::idx::Idx<Acc>;
+    using DevAcc = alpaka::dev::Dev<Acc>;
+    using PltfAcc = alpaka::pltf::Pltf<DevAcc>;
+
+    auto const devHost(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    auto const devAcc(alpaka::pltf::getDevByIdx<PltfAcc>(0u));
+    alpaka::test::queue::DefaultQueue<DevAcc> queue(devAcc);
+
+    // Extents which are neither powers of two nor multiples of the tile size.
+    Idx const extents[] = {7u, 13u, 5u, 3u};
+    auto gridBlockExtent(alpaka::vec::Vec<Dim, Idx>::ones());
+    for(typename Dim::value_type d(0u); d < Dim::value; ++d)
+    {
+        gridBlockExtent[d] = extents[d];
+    }
+    Idx const gridBlockCount(gridBlockExtent.prod());
+    alpaka::workdiv::WorkDivMembers<Dim, Idx> const workDiv(
+        gridBlockExtent,
+        alpaka::vec::Vec<Dim, Idx>::ones(),
+        alpaka::vec::Vec<Dim, Idx>::ones());
+
+    using Policy = alpaka::kernel::BlockSchedulingPolicy;
+    using Order = alpaka::kernel::BlockTraversalOrder;
+    for(auto const & blockSchedule : {
+        alpaka::kernel::BlockSchedule(Policy::Auto, 0u, Order::Tiled),
+        alpaka::kernel::BlockSchedule(Policy::Auto, 0u, Order::Tiled, 2u),
+        alpaka::kernel::BlockSchedule(Policy::Auto, 0u, Order::ZOrder),
+        alpaka::kernel::BlockSchedule(Policy::Auto, 0u, Order::Hilbert),
+        alpaka::kernel::BlockSchedule(Policy::Static, 0u, Order::Hilbert),
+        alpaka::kernel::BlockSchedule(Policy::Dynamic, 4u, Order::ZOrder)})
+    {
+        auto bufAcc(alpaka::mem::buf::alloc<std::uint32_t, Idx>(devAcc, gridBlockCount));
+        alpaka::mem::view::set(queue, bufAcc, static_cast<std::uint8_t>(0u), gridBlockCount);
+
+        alpaka::kernel::exec<Acc>(
+            queue,
+            workDiv,
+            KernelWithBlockSchedule(blockSchedule),
+            alpaka::mem::view::getPtrNative(bufAcc));
+
+        auto bufHost(alpaka::mem::buf::alloc<std::uint32_t, Idx>(devHost, gridBlockCount));
+        alpaka::mem::view::copy(queue, bufHost, bufAcc, gridBlockCount);
+        alpaka::wait::wait(queue);
+
+        auto const pBlockExecutionCounts(alpaka::mem::view::getPtrNative(bufHost));
+        for(Idx i(0u); i < gridBlockCount; ++i)
+        {
+            REQUIRE(pBlockExecutionCounts[i] == 1u);
+        }
+    }
+}
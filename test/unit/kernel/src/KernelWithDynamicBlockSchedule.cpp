@@ -0,0 +1,134 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/kernel/Traits.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/queue/Queue.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+
+//#############################################################################
+//! The run time of the blocks grows with their index.
+//! Each block sums up the numbers from 1 to its index plus one.
+class KernelWithImbalancedBlocks
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        std::uint32_t * const blockSums) const
+    -> void
+    {
+        auto const gridBlockIdx1d(
+            alpaka::idx::mapIdx<1u>(
+                alpaka::idx::getIdx<alpaka::Grid, alpaka::Blocks>(acc),
+                alpaka::workdiv::getWorkDiv<alpaka::Grid, alpaka::Blocks>(acc))[0]);
+
+        std::uint32_t sum(0u);
+        for(std::uint32_t i(1u); i <= static_cast<std::uint32_t>(gridBlockIdx1d) + 1u; ++i)
+        {
+            sum += i;
+        }
+        blockSums[gridBlockIdx1d] = sum;
+    }
+};
+
+namespace alpaka
+{
+    namespace kernel
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The run time of the blocks differs a lot.
+            //! The blocks are fetched one after the other to balance the load.
+            template<
+                typename TAcc>
+            struct GetBlockSchedule<
+                KernelWithImbalancedBlocks,
+                TAcc>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TDim>
+                ALPAKA_FN_HOST static auto getBlockSchedule(
+                    KernelWithImbalancedBlocks const & kernel,
+                    vec::Vec<TDim, idx::Idx<TAcc>> const & blockThreadExtent,
+                    vec::Vec<TDim, idx::Idx<TAcc>> const & threadElemExtent,
+                    std::uint32_t * const blockSums)
+                -> BlockSchedule
+                {
+                    alpaka::ignore_unused(kernel);
+                    alpaka::ignore_unused(blockThreadExtent);
+                    alpaka::ignore_unused(threadElemExtent);
+                    alpaka::ignore_unused(blockSums);
+
+                    return BlockSchedule(BlockSchedulingPolicy::Dynamic, 1u);
+                }
+            };
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE("kernelCanRequestDynamicBlockSchedule", "[kernel]", alpaka::test::acc::TestAccs)
+{
+    using Acc = TestType;
+    using Dim = alpaka::dim::Dim<Acc>;
+    using Idx = alpaka::idx::Idx<Acc>;
+    using DevAcc = alpaka::dev::Dev<Acc>;
+    using PltfAcc = alpaka::pltf::Pltf<DevAcc>;
+
+    auto const devHost(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    auto const devAcc(alpaka::pltf::getDevByIdx<PltfAcc>(0u));
+    alpaka::test::queue::DefaultQueue<DevAcc> queue(devAcc);
+
+    Idx const gridBlockCount(64u);
+    auto gridBlockExtent(alpaka::vec::Vec<Dim, Idx>::ones());
+    gridBlockExtent[0] = gridBlockCount;
+    alpaka::workdiv::WorkDivMembers<Dim, Idx> const workDiv(
+        gridBlockExtent,
+        alpaka::vec::Vec<Dim, Idx>::ones(),
+        alpaka::vec::Vec<Dim, Idx>::ones());
+
+    KernelWithImbalancedBlocks const kernel;
+
+    auto bufAcc(alpaka::mem::buf::alloc<std::uint32_t, Idx>(devAcc, gridBlockCount));
+    auto const blockSchedule(
+        alpaka::kernel::getBlockSchedule<Acc>(
+            kernel,
+            alpaka::vec::Vec<Dim, Idx>::ones(),
+            alpaka::vec::Vec<Dim, Idx>::ones(),
+            alpaka::mem::view::getPtrNative(bufAcc)));
+    CHECK(blockSchedule.m_policy == alpaka::kernel::BlockSchedulingPolicy::Dynamic);
+    CHECK(blockSchedule.m_chunkSize == 1u);
+
+    alpaka::kernel::exec<Acc>(
+        queue,
+        workDiv,
+        kernel,
+        alpaka::mem::view::getPtrNative(bufAcc));
+
+    auto bufHost(alpaka::mem::buf::alloc<std::uint32_t, Idx>(devHost, gridBlockCount));
+    alpaka::mem::view::copy(queue, bufHost, bufAcc, gridBlockCount);
+    alpaka::wait::wait(queue);
+
+    auto const pBlockSums(alpaka::mem::view::getPtrNative(bufHost));
+    for(Idx i(0u); i < gridBlockCount; ++i)
+    {
+        auto const n(static_cast<std::uint32_t>(i) + 1u);
+        REQUIRE(pBlockSums[i] == n * (n + 1u) / 2u);
+    }
+}
@@ -0,0 +1,246 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/acc/AccCpuThreads.hpp>
+#include <alpaka/dim/DimIntegralConst.hpp>
+#include <alpaka/graph/GraphCpu.hpp>
+#include <alpaka/graph/QueueCpuCapture.hpp>
+#include <alpaka/kernel/TaskKernelCpuThreads.hpp>
+#include <alpaka/mem/buf/BufCpu.hpp>
+#include <alpaka/mem/view/Traits.hpp>
+#include <alpaka/pltf/PltfCpu.hpp>
+#include <alpaka/queue/QueueCpuBlocking.hpp>
+#include <alpaka/queue/QueueCpuNonBlocking.hpp>
+#include <alpaka/vec/Vec.hpp>
+#include <alpaka/workdiv/WorkDivMembers.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+TEST_CASE("graphReplaysTheCapturedTasksInOrder", "[queue]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+
+    std::size_t const numTasks(100u);
+    std::vector<std::size_t> executedTasks;
+
+    alpaka::graph::GraphCaptureCpu capture(dev);
+    alpaka::graph::QueueCpuCapture captureQueue(capture);
+    for(std::size_t taskIdx(0u); taskIdx < numTasks; ++taskIdx)
+    {
+        alpaka::queue::enqueue(captureQueue, [&executedTasks, taskIdx](){executedTasks.push_back(taskIdx);});
+    }
+    CHECK(alpaka::queue::empty(captureQueue));
+    CHECK(executedTasks.empty());
+
+    alpaka::graph::GraphCpu const graph(capture);
+
+    std::size_t const numReplays(3u);
+    alpaka::queue::QueueCpuNonBlocking queue(dev);
+    for(std::size_t replayIdx(0u); replayIdx < numReplays; ++replayIdx)
+    {
+        alpaka::queue::enqueue(queue, graph);
+    }
+    alpaka::wait::wait(queue);
+
+    REQUIRE(executedTasks.size() == numReplays * numTasks);
+    for(std::size_t taskIdx(0u); taskIdx < executedTasks.size(); ++taskIdx)
+    {
+        REQUIRE(executedTasks[taskIdx] == taskIdx % numTasks);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("graphReplaysTheEventDependenciesBetweenCaptureQueues", "[queue]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+
+    using Elem = std::size_t;
+    using Idx = std::size_t;
+    using Dim = alpaka::dim::DimInt<1u>;
+    Idx const elemCount(1024u);
+    alpaka::vec::Vec<Dim, Idx> const extent(elemCount);
+    auto bufSrc(alpaka::mem::buf::alloc<Elem, Idx>(dev, extent));
+    auto bufDst(alpaka::mem::buf::alloc<Elem, Idx>(dev, extent));
+    auto const pSrc(alpaka::mem::view::getPtrNative(bufSrc));
+    auto const pDst(alpaka::mem::view::getPtrNative(bufDst));
+
+    std::atomic<std::size_t> replayCount(0u);
+    std::vector<std::size_t> mismatchCounts;
+
+    alpaka::graph::GraphCaptureCpu capture(dev);
+    alpaka::graph::QueueCpuCapture producer(capture);
+    alpaka::graph::QueueCpuCapture consumer(capture);
+    alpaka::event::EventCpu produced(dev);
+
+    // The producer writes the source buffer slowly so that a missing dependency would be observed by the consumer.
+    alpaka::queue::enqueue(
+        producer,
+        [pSrc, elemCount, &replayCount]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10u));
+            auto const value(++replayCount);
+            for(Idx i(0u); i < elemCount; ++i)
+            {
+                pSrc[i] = value;
+            }
+        });
+    alpaka::mem::view::copy(producer, bufDst, bufSrc, extent);
+    alpaka::queue::enqueue(producer, produced);
+
+    alpaka::wait::wait(consumer, produced);
+    alpaka::queue::enqueue(
+        consumer,
+        [pDst, elemCount, &replayCount, &mismatchCounts]()
+        {
+            std::size_t mismatchCount(0u);
+            for(Idx i(0u); i < elemCount; ++i)
+            {
+                if(pDst[i] != replayCount)
+                {
+                    ++mismatchCount;
+                }
+            }
+            mismatchCounts.push_back(mismatchCount);
+        });
+    CHECK(replayCount == 0u);
+
+    alpaka::graph::GraphCpu const graph(capture);
+
+    std::size_t const numReplays(5u);
+    alpaka::queue::QueueCpuBlocking queue(dev);
+    for(std::size_t replayIdx(0u); replayIdx < numReplays; ++replayIdx)
+    {
+        alpaka::queue::enqueue(queue, graph);
+    }
+
+    REQUIRE(replayCount == numReplays);
+    REQUIRE(mismatchCounts == std::vector<std::size_t>(numReplays, 0u));
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("graphReplayRethrowsTheFirstExceptionAfterAllTasks", "[queue]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+
+    std::atomic<std::size_t> executedTaskCount(0u);
+
+    alpaka::graph::GraphCaptureCpu capture(dev);
+    alpaka::graph::QueueCpuCapture first(capture);
+    alpaka::graph::QueueCpuCapture second(capture);
+    alpaka::event::EventCpu event(dev);
+    alpaka::queue::enqueue(first, [](){throw std::runtime_error("node failed");});
+    alpaka::queue::enqueue(first, event);
+    alpaka::wait::wait(second, event);
+    alpaka::queue::enqueue(second, [&executedTaskCount](){++executedTaskCount;});
+    alpaka::queue::enqueue(first, [&executedTaskCount](){++executedTaskCount;});
+
+    alpaka::graph::GraphCpu const graph(capture);
+
+    REQUIRE_THROWS_AS(graph(), std::runtime_error);
+    REQUIRE(executedTaskCount == 2u);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("graphReplayCompletesTheEventsEnqueuedIntoCaptureQueues", "[queue]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+
+    std::atomic<bool> started(false);
+    std::atomic<bool> released(false);
+
+    alpaka::graph::GraphCaptureCpu capture(dev);
+    alpaka::graph::QueueCpuCapture captureQueue(capture);
+    alpaka::event::EventCpu event(dev);
+    alpaka::queue::enqueue(
+        captureQueue,
+        [&started, &released]()
+        {
+            started = true;
+            while(!released)
+            {
+                std::this_thread::yield();
+            }
+        });
+    alpaka::queue::enqueue(captureQueue, event);
+    // Nothing is enqueued during the capture.
+    CHECK(alpaka::event::test(event));
+
+    alpaka::graph::GraphCpu const graph(capture);
+
+    std::size_t const numReplays(3u);
+    alpaka::queue::QueueCpuNonBlocking queue(dev);
+    for(std::size_t replayIdx(0u); replayIdx < numReplays; ++replayIdx)
+    {
+        started = false;
+        released = false;
+        alpaka::queue::enqueue(queue, graph);
+        while(!started)
+        {
+            std::this_thread::yield();
+        }
+
+        // The event is pending until the replay reaches its position.
+        CHECK(!alpaka::event::test(event));
+        released = true;
+        alpaka::wait::wait(event);
+        CHECK(alpaka::event::test(event));
+    }
+    alpaka::wait::wait(queue);
+}
+
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+//#############################################################################
+class GraphCpuTestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const &) const
+    -> void
+    {}
+};
+
+//-----------------------------------------------------------------------------
+TEST_CASE("graphKernelsLeaseTheBlockThreadsWithTheCaptureQueuePriority", "[queue]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+
+    using Idx = std::size_t;
+    using Dim = alpaka::dim::DimInt<1u>;
+    using Acc = alpaka::acc::AccCpuThreads<Dim, Idx>;
+    alpaka::workdiv::WorkDivMembers<Dim, Idx> const workDiv(
+        alpaka::vec::Vec<Dim, Idx>(static_cast<Idx>(1u)),
+        alpaka::vec::Vec<Dim, Idx>(static_cast<Idx>(2u)),
+        alpaka::vec::Vec<Dim, Idx>(static_cast<Idx>(1u)));
+
+    alpaka::graph::GraphCaptureCpu capture(dev);
+    alpaka::graph::QueueCpuCapture captureQueue(capture, alpaka::queue::Priority::High);
+    alpaka::queue::enqueue(captureQueue, alpaka::kernel::createTaskKernel<Acc>(workDiv, GraphCpuTestKernel()));
+
+    alpaka::graph::GraphCpu const graph(capture);
+
+    auto const highClaimCount(dev.getBlockThreadClaimLatency(alpaka::queue::Priority::High).m_count);
+    auto const normalClaimCount(dev.getBlockThreadClaimLatency(alpaka::queue::Priority::Normal).m_count);
+    graph();
+
+    CHECK(dev.getBlockThreadClaimLatency(alpaka::queue::Priority::High).m_count == highClaimCount + 1u);
+    CHECK(dev.getBlockThreadClaimLatency(alpaka::queue::Priority::Normal).m_count == normalClaimCount);
+}
+#endif
@@ -0,0 +1,198 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/acc/AccCpuThreads.hpp>
+#include <alpaka/dim/DimIntegralConst.hpp>
+#include <alpaka/kernel/TaskKernelCpuThreads.hpp>
+#include <alpaka/mem/buf/BufCpu.hpp>
+#include <alpaka/mem/view/Traits.hpp>
+#include <alpaka/pltf/PltfCpu.hpp>
+#include <alpaka/queue/QueueCpuNonBlocking.hpp>
+#include <alpaka/queue/cpu/IsCheapTask.hpp>
+#include <alpaka/vec/Vec.hpp>
+#include <alpaka/workdiv/WorkDivMembers.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <thread>
+#include <vector>
+
+//#############################################################################
+//! A task recording the thread executing it.
+struct CheapTask
+{
+    //-----------------------------------------------------------------------------
+    auto operator()() const
+    -> void
+    {
+        m_executingThread.get() = std::this_thread::get_id();
+    }
+
+    std::reference_wrapper<std::thread::id> m_executingThread;
+};
+
+namespace alpaka
+{
+    namespace queue
+    {
+        namespace traits
+        {
+            //#############################################################################
+            template<>
+            struct IsCheapTask<
+                CheapTask>
+            {
+                //-----------------------------------------------------------------------------
+                static auto isCheapTask(
+                    CheapTask const &)
+                -> bool
+                {
+                    return true;
+                }
+            };
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("nonBlockingInlineQueueExecutesCheapTasksOnTheCallingThreadWhileIdle", "[queue]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    alpaka::queue::QueueCpuNonBlockingInline queue(dev);
+
+    std::thread::id cheapTaskThread;
+    alpaka::queue::enqueue(queue, CheapTask{std::ref(cheapTaskThread)});
+    CHECK(cheapTaskThread == std::this_thread::get_id());
+    CHECK(alpaka::queue::empty(queue));
+
+    // Arbitrary tasks are not known to be cheap.
+    std::thread::id otherTaskThread;
+    alpaka::queue::enqueue(queue, [&otherTaskThread](){otherTaskThread = std::this_thread::get_id();});
+    alpaka::wait::wait(queue);
+    CHECK(otherTaskThread != std::this_thread::get_id());
+
+    // The same task is executed asynchronously by the queue without the property.
+    alpaka::queue::QueueCpuNonBlocking asyncQueue(dev);
+    alpaka::queue::enqueue(asyncQueue, CheapTask{std::ref(cheapTaskThread)});
+    alpaka::wait::wait(asyncQueue);
+    CHECK(cheapTaskThread != std::this_thread::get_id());
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("nonBlockingInlineQueueExecutesCheapTasksInOrderWhileBusy", "[queue]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    alpaka::queue::QueueCpuNonBlockingInline queue(dev);
+
+    std::promise<void> release;
+    auto releaseFuture(release.get_future().share());
+    std::vector<std::size_t> executedTasks;
+    alpaka::queue::enqueue(
+        queue,
+        [releaseFuture, &executedTasks]()
+        {
+            releaseFuture.wait();
+            executedTasks.push_back(0u);
+        });
+
+    std::thread::id cheapTaskThread;
+    alpaka::queue::enqueue(queue, CheapTask{std::ref(cheapTaskThread)});
+    alpaka::queue::enqueue(queue, [&executedTasks](){executedTasks.push_back(1u);});
+    CHECK(!alpaka::queue::empty(queue));
+
+    release.set_value();
+    alpaka::wait::wait(queue);
+
+    CHECK(cheapTaskThread != std::this_thread::get_id());
+    CHECK(executedTasks == std::vector<std::size_t>{0u, 1u});
+    CHECK(alpaka::queue::empty(queue));
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("nonBlockingInlineQueueCompletesEventsWhileIdle", "[queue]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    alpaka::queue::QueueCpuNonBlockingInline queue(dev);
+    alpaka::event::EventCpu event(dev);
+
+    alpaka::queue::enqueue(queue, event);
+    CHECK(alpaka::event::test(event));
+
+    std::promise<void> release;
+    auto releaseFuture(release.get_future().share());
+    alpaka::queue::enqueue(queue, [releaseFuture](){releaseFuture.wait();});
+    alpaka::queue::enqueue(queue, event);
+    CHECK(!alpaka::event::test(event));
+
+    release.set_value();
+    alpaka::wait::wait(event);
+    CHECK(alpaka::event::test(event));
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("tasksWithAWorkDivAreCheapIfTheyHaveFewElements", "[queue]")
+{
+    using Dim = alpaka::dim::DimInt<1u>;
+    using Idx = std::size_t;
+    using Vec = alpaka::vec::Vec<Dim, Idx>;
+    using WorkDiv = alpaka::workdiv::WorkDivMembers<Dim, Idx>;
+
+    Vec const one(static_cast<Idx>(1u));
+    Vec const two(static_cast<Idx>(2u));
+    Vec const maxElemCount(static_cast<Idx>(ALPAKA_CPU_QUEUE_INLINE_MAX_ELEMS));
+    CHECK(alpaka::queue::isCheapTask(WorkDiv(one, one, maxElemCount)));
+    CHECK(!alpaka::queue::isCheapTask(WorkDiv(two, one, maxElemCount)));
+    CHECK(!alpaka::queue::isCheapTask([](){}));
+}
+
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+//#############################################################################
+class QueueInlineTestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const &,
+        std::size_t * const pValue) const
+    -> void
+    {
+        *pValue = 42u;
+    }
+};
+
+//-----------------------------------------------------------------------------
+TEST_CASE("nonBlockingInlineQueueExecutesCheapKernelsOnTheCallingThreadWhileIdle", "[queue]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    alpaka::queue::QueueCpuNonBlockingInline queue(dev);
+
+    using Idx = std::size_t;
+    using Dim = alpaka::dim::DimInt<1u>;
+    using Acc = alpaka::acc::AccCpuThreads<Dim, Idx>;
+    alpaka::vec::Vec<Dim, Idx> const one(static_cast<Idx>(1u));
+    auto buf(alpaka::mem::buf::alloc<std::size_t, Idx>(dev, one));
+    auto const pValue(alpaka::mem::view::getPtrNative(buf));
+    *pValue = 0u;
+
+    // Kernel tasks are estimated by the generic enqueue like any other task.
+    alpaka::queue::enqueue(
+        queue,
+        alpaka::kernel::createTaskKernel<Acc>(alpaka::workdiv::WorkDivMembers<Dim, Idx>(one, one, one), QueueInlineTestKernel(), pValue));
+
+    // The kernel has been completed before the enqueue returned.
+    CHECK(*pValue == 42u);
+    CHECK(alpaka::queue::empty(queue));
+}
+#endif
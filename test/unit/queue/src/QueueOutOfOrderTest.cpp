@@ -0,0 +1,258 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/acc/AccCpuThreads.hpp>
+#include <alpaka/core/StrandExecutor.hpp>
+#include <alpaka/dim/DimIntegralConst.hpp>
+#include <alpaka/kernel/TaskKernelCpuThreads.hpp>
+#include <alpaka/mem/buf/BufCpu.hpp>
+#include <alpaka/pltf/PltfCpu.hpp>
+#include <alpaka/queue/QueueCpuNonBlocking.hpp>
+#include <alpaka/queue/QueueCpuOutOfOrder.hpp>
+#include <alpaka/queue/TaskWithDependencies.hpp>
+#include <alpaka/vec/Vec.hpp>
+#include <alpaka/workdiv/WorkDivMembers.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+TEST_CASE("outOfOrderQueueExecutesIndependentTasksConcurrently", "[queue]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    alpaka::queue::QueueCpuOutOfOrder queue(dev);
+
+    // Each task waits for the other one, so they can only complete when they are executed concurrently.
+    // The waits are marked as blocking, so the executor starts another worker even with a single hardware thread.
+    std::promise<void> firstStarted;
+    std::promise<void> secondStarted;
+    auto firstStartedFuture(firstStarted.get_future());
+    auto secondStartedFuture(secondStarted.get_future());
+    std::atomic<bool> firstSawSecond(false);
+    std::atomic<bool> secondSawFirst(false);
+
+    alpaka::queue::enqueue(
+        queue,
+        [&]()
+        {
+            firstStarted.set_value();
+            alpaka::core::detail::StrandExecutor::BlockingScope const blocking;
+            firstSawSecond = (secondStartedFuture.wait_for(std::chrono::seconds(10u)) == std::future_status::ready);
+        });
+    alpaka::queue::enqueue(
+        queue,
+        [&]()
+        {
+            secondStarted.set_value();
+            alpaka::core::detail::StrandExecutor::BlockingScope const blocking;
+            secondSawFirst = (firstStartedFuture.wait_for(std::chrono::seconds(10u)) == std::future_status::ready);
+        });
+
+    alpaka::wait::wait(queue);
+
+    CHECK(alpaka::queue::empty(queue));
+    CHECK(firstSawSecond);
+    CHECK(secondSawFirst);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("outOfOrderQueueOrdersTasksDependingOnTheSameMemory", "[queue]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    alpaka::queue::QueueCpuOutOfOrder queue(dev);
+
+    using Dim = alpaka::dim::DimInt<1u>;
+    using Idx = std::size_t;
+    alpaka::vec::Vec<Dim, Idx> const extent(static_cast<Idx>(1u));
+    auto bufA(alpaka::mem::buf::alloc<int, Idx>(dev, extent));
+    auto bufB(alpaka::mem::buf::alloc<int, Idx>(dev, extent));
+
+    std::size_t const numTasks(100u);
+    std::vector<std::size_t> executedTasksA;
+    std::vector<std::size_t> executedTasksB;
+    std::vector<std::size_t> executedTasksAB;
+    for(std::size_t taskIdx(0u); taskIdx < numTasks; ++taskIdx)
+    {
+        // The tasks of both buffers interleave but each buffer is accessed by one task at a time.
+        alpaka::queue::enqueue(queue, alpaka::queue::dependsOn([&executedTasksA, taskIdx](){executedTasksA.push_back(taskIdx);}, bufA));
+        alpaka::queue::enqueue(queue, alpaka::queue::dependsOn([&executedTasksB, taskIdx](){executedTasksB.push_back(taskIdx);}, bufB));
+        if(taskIdx % 10u == 0u)
+        {
+            alpaka::queue::enqueue(
+                queue,
+                alpaka::queue::dependsOn(
+                    [&executedTasksA, &executedTasksB, &executedTasksAB, taskIdx]()
+                    {
+                        if(executedTasksA.size() == taskIdx + 1u && executedTasksB.size() == taskIdx + 1u)
+                        {
+                            executedTasksAB.push_back(taskIdx);
+                        }
+                    },
+                    bufA,
+                    bufB,
+                    bufA));
+        }
+    }
+
+    alpaka::wait::wait(queue);
+
+    REQUIRE(executedTasksA.size() == numTasks);
+    REQUIRE(executedTasksB.size() == numTasks);
+    for(std::size_t taskIdx(0u); taskIdx < numTasks; ++taskIdx)
+    {
+        REQUIRE(executedTasksA[taskIdx] == taskIdx);
+        REQUIRE(executedTasksB[taskIdx] == taskIdx);
+    }
+    REQUIRE(executedTasksAB.size() == numTasks / 10u);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("outOfOrderQueueTasksWaitForEvents", "[queue]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    alpaka::queue::QueueCpuOutOfOrder queue(dev);
+    alpaka::queue::QueueCpuNonBlocking producer(dev);
+
+    std::atomic<bool> produced(false);
+    alpaka::event::EventCpu event(dev);
+    alpaka::queue::enqueue(
+        producer,
+        [&produced]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50u));
+            produced = true;
+        });
+    alpaka::queue::enqueue(producer, event);
+
+    // A task depending on the event.
+    std::atomic<bool> consumerSawProduced(false);
+    alpaka::queue::enqueue(
+        queue,
+        alpaka::queue::dependsOn([&](){consumerSawProduced = produced.load();}, event));
+
+    // All tasks enqueued after waiting for the event.
+    std::atomic<bool> laterTaskSawProduced(false);
+    alpaka::wait::wait(queue, event);
+    alpaka::queue::enqueue(queue, [&](){laterTaskSawProduced = produced.load();});
+
+    alpaka::wait::wait(queue);
+
+    CHECK(consumerSawProduced);
+    CHECK(laterTaskSawProduced);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("outOfOrderQueueEventWaitsForAllTasksEnqueuedBefore", "[queue]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    alpaka::queue::QueueCpuOutOfOrder queue(dev);
+
+    std::size_t const numTasks(16u);
+    std::atomic<std::size_t> completedTaskCount(0u);
+    for(std::size_t taskIdx(0u); taskIdx < numTasks; ++taskIdx)
+    {
+        alpaka::queue::enqueue(
+            queue,
+            [&completedTaskCount, taskIdx]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(taskIdx));
+                ++completedTaskCount;
+            });
+    }
+    alpaka::event::EventCpu event(dev);
+    alpaka::queue::enqueue(queue, event);
+
+    alpaka::wait::wait(event);
+    CHECK(completedTaskCount == numTasks);
+    CHECK(alpaka::event::test(event));
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("outOfOrderQueueTasksWaitingForEventsDoNotOccupyAWorker", "[queue]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    alpaka::queue::QueueCpuOutOfOrder queue(dev, alpaka::queue::Priority::Low);
+    alpaka::queue::QueueCpuNonBlocking producer(dev);
+
+    std::promise<void> release;
+    auto releaseFuture(release.get_future().share());
+    alpaka::event::EventCpu event(dev);
+    alpaka::queue::enqueue(producer, [releaseFuture](){releaseFuture.wait();});
+    alpaka::queue::enqueue(producer, event);
+
+    auto const startCount(dev.getQueueStartLatency(alpaka::queue::Priority::Low).m_count);
+    std::atomic<std::size_t> executedTaskCount(0u);
+    alpaka::queue::enqueue(queue, alpaka::queue::dependsOn([&executedTaskCount](){++executedTaskCount;}, event));
+    alpaka::wait::wait(queue, event);
+    alpaka::queue::enqueue(queue, [&executedTaskCount](){++executedTaskCount;});
+
+    // Nothing is handed to the executor before the event has been completed.
+    CHECK(dev.getQueueStartLatency(alpaka::queue::Priority::Low).m_count == startCount);
+    CHECK(!alpaka::queue::empty(queue));
+
+    release.set_value();
+    alpaka::wait::wait(queue);
+    CHECK(executedTaskCount == 2u);
+}
+
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+//#############################################################################
+class QueueOutOfOrderTestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const &) const
+    -> void
+    {}
+};
+
+//-----------------------------------------------------------------------------
+TEST_CASE("outOfOrderQueueKernelsWithDependenciesLeaseTheBlockThreadsWithTheQueuePriority", "[queue]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+    alpaka::queue::QueueCpuOutOfOrder queue(dev, alpaka::queue::Priority::High);
+
+    using Idx = std::size_t;
+    using Dim = alpaka::dim::DimInt<1u>;
+    using Acc = alpaka::acc::AccCpuThreads<Dim, Idx>;
+    alpaka::vec::Vec<Dim, Idx> const extent(static_cast<Idx>(16u));
+    auto buf(alpaka::mem::buf::alloc<std::size_t, Idx>(dev, extent));
+    alpaka::workdiv::WorkDivMembers<Dim, Idx> const workDiv(
+        alpaka::vec::Vec<Dim, Idx>(static_cast<Idx>(1u)),
+        alpaka::vec::Vec<Dim, Idx>(static_cast<Idx>(2u)),
+        alpaka::vec::Vec<Dim, Idx>(static_cast<Idx>(1u)));
+
+    // The second kernel is handed to the executor by the thread completing the event it depends on.
+    alpaka::queue::QueueCpuNonBlocking producer(dev);
+    std::promise<void> release;
+    auto releaseFuture(release.get_future().share());
+    alpaka::event::EventCpu event(dev);
+    alpaka::queue::enqueue(producer, [releaseFuture](){releaseFuture.wait();});
+    alpaka::queue::enqueue(producer, event);
+
+    auto const highClaimCount(dev.getBlockThreadClaimLatency(alpaka::queue::Priority::High).m_count);
+    auto const task(alpaka::kernel::createTaskKernel<Acc>(workDiv, QueueOutOfOrderTestKernel()));
+    alpaka::queue::enqueue(queue, alpaka::queue::dependsOn(task, buf));
+    alpaka::queue::enqueue(queue, alpaka::queue::dependsOn(task, event));
+    release.set_value();
+    alpaka::wait::wait(queue);
+
+    CHECK(dev.getBlockThreadClaimLatency(alpaka::queue::Priority::High).m_count == highClaimCount + 2u);
+}
+#endif
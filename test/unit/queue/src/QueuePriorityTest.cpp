@@ -0,0 +1,98 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/acc/AccCpuThreads.hpp>
+#include <alpaka/dim/DimIntegralConst.hpp>
+#include <alpaka/kernel/TaskKernelCpuThreads.hpp>
+#include <alpaka/pltf/PltfCpu.hpp>
+#include <alpaka/queue/Properties.hpp>
+#include <alpaka/queue/QueueCpuBlocking.hpp>
+#include <alpaka/queue/QueueCpuNonBlocking.hpp>
+#include <alpaka/vec/Vec.hpp>
+#include <alpaka/workdiv/WorkDivMembers.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+
+//-----------------------------------------------------------------------------
+TEST_CASE("queueStartLatencyIsRecordedPerPriority", "[queue]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+
+    // The device state is shared with the other handles, so only the starts of this test are counted.
+    auto const highStartCount(dev.getQueueStartLatency(alpaka::queue::Priority::High).m_count);
+    auto const lowStartCount(dev.getQueueStartLatency(alpaka::queue::Priority::Low).m_count);
+
+    std::size_t const taskCount(10u);
+    alpaka::queue::QueueCpuNonBlocking highQueue(dev, alpaka::queue::Priority::High);
+    for(std::size_t taskIdx(0u); taskIdx < taskCount; ++taskIdx)
+    {
+        alpaka::queue::enqueue(highQueue, [](){});
+        alpaka::wait::wait(highQueue);
+    }
+
+    // A queue which is still executing when a task is enqueued does not wait for a worker again.
+    auto const highLatency(dev.getQueueStartLatency(alpaka::queue::Priority::High));
+    CHECK(highLatency.m_count > highStartCount);
+    CHECK(highLatency.m_max >= highLatency.getMean());
+    CHECK(highLatency.m_total >= highLatency.m_max);
+
+    CHECK(dev.getQueueStartLatency(alpaka::queue::Priority::Low).m_count == lowStartCount);
+}
+
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+//#############################################################################
+class QueuePriorityTestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const &) const
+    -> void
+    {}
+};
+
+//-----------------------------------------------------------------------------
+TEST_CASE("kernelsLeaseTheBlockThreadsWithThePriorityOfTheQueueExecutingThem", "[queue]")
+{
+    auto const dev(alpaka::pltf::getDevByIdx<alpaka::pltf::PltfCpu>(0u));
+
+    using Idx = std::size_t;
+    using Dim = alpaka::dim::DimInt<1u>;
+    using Acc = alpaka::acc::AccCpuThreads<Dim, Idx>;
+    alpaka::workdiv::WorkDivMembers<Dim, Idx> const workDiv(
+        alpaka::vec::Vec<Dim, Idx>(static_cast<Idx>(1u)),
+        alpaka::vec::Vec<Dim, Idx>(static_cast<Idx>(2u)),
+        alpaka::vec::Vec<Dim, Idx>(static_cast<Idx>(1u)));
+    auto const task(alpaka::kernel::createTaskKernel<Acc>(workDiv, QueuePriorityTestKernel()));
+
+    auto const highClaimCount(dev.getBlockThreadClaimLatency(alpaka::queue::Priority::High).m_count);
+    auto const lowClaimCount(dev.getBlockThreadClaimLatency(alpaka::queue::Priority::Low).m_count);
+
+    // Kernels executed within host tasks lease the block threads the same way as kernels enqueued directly.
+    alpaka::queue::QueueCpuNonBlocking highQueue(dev, alpaka::queue::Priority::High);
+    alpaka::queue::enqueue(highQueue, task);
+    alpaka::queue::enqueue(highQueue, [task](){task();});
+    alpaka::wait::wait(highQueue);
+    alpaka::queue::QueueCpuBlocking lowQueue(dev, alpaka::queue::Priority::Low);
+    alpaka::queue::enqueue(lowQueue, [task](){task();});
+
+    CHECK(dev.getBlockThreadClaimLatency(alpaka::queue::Priority::High).m_count == highClaimCount + 2u);
+    CHECK(dev.getBlockThreadClaimLatency(alpaka::queue::Priority::Low).m_count == lowClaimCount + 1u);
+
+    // Outside of a queue the kernel does not know a device to lease the block threads from.
+    auto const normalClaimCount(dev.getBlockThreadClaimLatency(alpaka::queue::Priority::Normal).m_count);
+    task();
+    CHECK(dev.getBlockThreadClaimLatency(alpaka::queue::Priority::Normal).m_count == normalClaimCount);
+}
+#endif
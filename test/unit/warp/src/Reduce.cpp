@@ -0,0 +1,153 @@
+/* Copyright 2020 Bernhard Manfred Gruber
+ *
+ * This file is part of Alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/warp/Traits.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/queue/Queue.hpp>
+#include <alpaka/test/KernelExecutionFixture.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+
+//#############################################################################
+struct SumOp
+{
+    //-----------------------------------------------------------------------------
+    ALPAKA_FN_HOST_ACC auto operator()(
+        std::int32_t const & a,
+        std::int32_t const & b) const
+    -> std::int32_t
+    {
+        return a + b;
+    }
+};
+
+//#############################################################################
+struct MaxOp
+{
+    //-----------------------------------------------------------------------------
+    ALPAKA_FN_HOST_ACC auto operator()(
+        std::int32_t const & a,
+        std::int32_t const & b) const
+    -> std::int32_t
+    {
+        return a > b ? a : b;
+    }
+};
+
+//#############################################################################
+class ReduceSingleThreadWarpTestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        bool * success) const
+    -> void
+    {
+        std::int32_t const warpExtent = alpaka::warp::getSize(acc);
+        ALPAKA_CHECK(*success, warpExtent == 1);
+
+        ALPAKA_CHECK(*success, alpaka::warp::reduce(acc, 42, SumOp()) == 42);
+        ALPAKA_CHECK(*success, alpaka::warp::inclusiveScan(acc, 42, SumOp()) == 42);
+        ALPAKA_CHECK(*success, alpaka::warp::exclusiveScan(acc, 42, SumOp(), 0) == 0);
+    }
+};
+
+//#############################################################################
+class ReduceMultipleThreadWarpTestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        bool * success) const
+    -> void
+    {
+        std::int32_t const warpExtent = alpaka::warp::getSize(acc);
+        ALPAKA_CHECK(*success, warpExtent > 1);
+
+        // Test relies on having a single warp per thread block
+        auto const blockExtent = alpaka::workdiv::getWorkDiv<alpaka::Block, alpaka::Threads>(acc);
+        ALPAKA_CHECK(*success, static_cast<std::int32_t>(blockExtent.prod()) == warpExtent);
+        auto const localThreadIdx = alpaka::idx::getIdx<alpaka::Block, alpaka::Threads>(acc);
+        auto const threadIdxInWarp = static_cast<std::int32_t>(alpaka::idx::mapIdx<1u>(
+            localThreadIdx,
+            blockExtent)[0]);
+        ALPAKA_CHECK(*success, alpaka::warp::getLaneIdx(acc) == threadIdxInWarp);
+
+        // All threads of the warp have to participate and receive the result.
+        ALPAKA_CHECK(
+            *success,
+            alpaka::warp::reduce(acc, threadIdxInWarp + 1, SumOp()) == warpExtent * (warpExtent + 1) / 2);
+        ALPAKA_CHECK(
+            *success,
+            alpaka::warp::reduce(acc, threadIdxInWarp, MaxOp()) == warpExtent - 1);
+        ALPAKA_CHECK(
+            *success,
+            alpaka::warp::inclusiveScan(acc, threadIdxInWarp + 1, SumOp()) == (threadIdxInWarp + 1) * (threadIdxInWarp + 2) / 2);
+        ALPAKA_CHECK(
+            *success,
+            alpaka::warp::exclusiveScan(acc, threadIdxInWarp + 1, SumOp(), 0) == threadIdxInWarp * (threadIdxInWarp + 1) / 2);
+    }
+};
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "reduce", "[warp]", alpaka::test::acc::TestAccs)
+{
+    using Acc = TestType;
+    using Dev = alpaka::dev::Dev<Acc>;
+    using Pltf = alpaka::pltf::Pltf<Dev>;
+    using Dim = alpaka::dim::Dim<Acc>;
+    using Idx = alpaka::idx::Idx<Acc>;
+
+    Dev const dev(alpaka::pltf::getDevByIdx<Pltf>(0u));
+    auto const warpExtent = alpaka::dev::getWarpSize(dev);
+    if (warpExtent == 1)
+    {
+        Idx const gridThreadExtentPerDim = 4;
+        alpaka::test::KernelExecutionFixture<Acc> fixture(
+            alpaka::vec::Vec<Dim, Idx>::all(gridThreadExtentPerDim));
+        ReduceSingleThreadWarpTestKernel kernel;
+        REQUIRE(
+            fixture(
+                kernel));
+    }
+    else
+    {
+        // Work around gcc 7.5 trying and failing to offload for OpenMP 4.0
+#if BOOST_COMP_GNUC && (BOOST_COMP_GNUC == BOOST_VERSION_NUMBER(7, 5, 0)) && defined ALPAKA_ACC_CPU_BT_OMP4_ENABLED
+        return;
+#else
+        using ExecutionFixture = alpaka::test::KernelExecutionFixture<Acc>;
+        auto const gridBlockExtent = alpaka::vec::Vec<Dim, Idx>::all(2);
+        // Enforce one warp per thread block
+        auto blockThreadExtent = alpaka::vec::Vec<Dim, Idx>::ones();
+        blockThreadExtent[0] = static_cast<Idx>(warpExtent);
+        auto const threadElementExtent = alpaka::vec::Vec<Dim, Idx>::ones();
+        auto workDiv = typename ExecutionFixture::WorkDiv{
+            gridBlockExtent,
+            blockThreadExtent,
+            threadElementExtent};
+        auto fixture = ExecutionFixture{ workDiv };
+        ReduceMultipleThreadWarpTestKernel kernel;
+        REQUIRE(
+            fixture(
+                kernel));
+#endif
+    }
+}